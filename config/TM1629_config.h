@@ -43,12 +43,102 @@ extern "C" {
  */   
 #define TM1629_CONFIG_SUPPORT_COM_ANODE  1
 
+/**
+ * @brief  Enable support for buffered mode (shadow of display RAM + Flush)
+ */
+#define TM1629_CONFIG_SUPPORT_BUFFERED_MODE  1
+
+/**
+ * @brief  Overhead of one STB framed transaction in bit times (used by the
+ *         flush planner to decide between merging and splitting writes)
+ */
+#define TM1629_CONFIG_TRANSACTION_COST  8
+
 /**
  * @brief  Define the communication interface to use
 */
 #define TM1629_CONFIG_SUPPORT_GPIO   1
 #define TM1629_CONFIG_SUPPORT_SPI    0
 
+/**
+ * @brief  Enable support for several chips sharing CLK and DIO lines
+ *         (TM1629_Bus_t) and the maximum number of chips on one bus
+ */
+#define TM1629_CONFIG_SUPPORT_BUS       0
+#define TM1629_CONFIG_BUS_MAX_HANDLERS  8
+
+/**
+ * @brief  Enable support for several chips sharing CLK and STB lines, each on
+ *         its own DIO pin of one GPIO port (TM1629_WideBus_t), and the maximum
+ *         number of chips on one wide bus
+ */
+#define TM1629_CONFIG_SUPPORT_WIDE_BUS       0
+#define TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS  8
+
+/**
+ * @brief  Bind pin and delay functions of GPIO communication at compile time
+ *         instead of through the function pointers of the handler
+ * @note   The header (TM1629_CONFIG_STATIC_PLATFORM_HEADER, default
+ *         "TM1629_platform_static.h") is included by TM1629.c and must define
+ *         these macros or static inline functions of the port:
+ *         TM1629_PORT_WRITE_STB(CONTEXT, STATE), TM1629_PORT_WRITE_CLK(CONTEXT, STATE),
+ *         TM1629_PORT_WRITE_DIO(CONTEXT, STATE), TM1629_PORT_READ_DIO(CONTEXT),
+ *         TM1629_PORT_DIR_DIO(CONTEXT, DIR), TM1629_PORT_DELAY_NS(CONTEXT, DELAY)
+ *         ('CONTEXT' is 'Platform.Context' of the handler).
+ */
+#define TM1629_CONFIG_STATIC_PLATFORM  0
+
+/**
+ * @brief  Link platform dependent layer functions of all handlers through one
+ *         shared const table (TM1629_PlatformOps_t, TM1629_PLATFORM_LINK_OPS)
+ *         instead of function pointers copied into each handler
+ */
+#define TM1629_CONFIG_SHARED_PLATFORM_OPS  0
+
+/**
+ * @brief  Enable GPIO communication through memory-mapped set/clear/input
+ *         registers written by the driver itself (no pin function calls)
+ * @note   TM1629_CONFIG_MMIO_STORE(REG, VALUE) and TM1629_CONFIG_MMIO_LOAD(REG)
+ *         can be defined here to replace the register accesses (e.g. by the
+ *         hooks of the simulated TM1629).
+ */
+#define TM1629_CONFIG_SUPPORT_MMIO  0
+
+/**
+ * @brief  Enable sending write transactions over GPIO as compiled waveforms of
+ *         port words played by the port (e.g. DMA to the GPIO output register)
+ */
+#define TM1629_CONFIG_SUPPORT_WAVEFORM  0
+
+/**
+ * @brief  Enable non-blocking flush of the display RAM shadow over GPIO
+ *         (TM1629_FlushAsync and TM1629_Poll)
+ */
+#define TM1629_CONFIG_SUPPORT_ASYNC  0
+
+/**
+ * @brief  Enable timer driven asynchronous flush: a periodic timer calls
+ *         TM1629_TimerTick and each tick makes one edge (needs
+ *         TM1629_CONFIG_SUPPORT_ASYNC)
+ */
+#define TM1629_CONFIG_SUPPORT_TIMER  0
+
+/**
+ * @brief  Enable runtime statistics (TM1629_GetStats)
+ */
+#define TM1629_CONFIG_ENABLE_STATS  0
+
+/**
+ * @brief  Enable transaction trace hooks (TM1629_TRACE_LINK_HOOKS)
+ */
+#define TM1629_CONFIG_ENABLE_TRACE  0
+
+/**
+ * @brief  Enable calibration of GPIO delays at TM1629_Init (needs GetTimeNs
+ *         platform function)
+ */
+#define TM1629_CONFIG_ENABLE_CALIBRATION  0
+
 
 #ifdef __cplusplus
 }
@@ -33,6 +33,50 @@
 #include "freertos/FreeRTOS.h"
 #include "driver/gpio.h"
 #include "rom/ets_sys.h"
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+#include "esp_timer.h"
+#endif
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+#include "soc/gpio_reg.h"
+#endif
+
+
+/* Private Macros ---------------------------------------------------------------*/
+#define TM1629_PINS(CONTEXT)  ((const TM1629_Platform_Pins_t *)(CONTEXT))
+#define TM1629_SPI(CONTEXT)   ((TM1629_Platform_SPI_t *)(CONTEXT))
+
+
+
+/* Private variables ------------------------------------------------------------*/
+static const TM1629_Platform_Pins_t TM1629_Pins_3Wire =
+{
+  .CLK = TM1629_CLK_GPIO,
+  .STB = TM1629_STB_GPIO,
+  .DIN = TM1629_DIO_GPIO,
+  .DOUT = TM1629_DIO_GPIO,
+};
+
+static const TM1629_Platform_Pins_t TM1629_Pins_4Wire =
+{
+  .CLK = TM1629_CLK_GPIO,
+  .STB = TM1629_STB_GPIO,
+  .DIN = TM1629_DIN_GPIO,
+  .DOUT = TM1629_DOUT_GPIO,
+};
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+static TM1629_Platform_SPI_t TM1629_SPI_Default =
+{
+  .Pins =
+  {
+    .CLK = TM1629_CLK_GPIO,
+    .STB = TM1629_STB_GPIO,
+    .DIN = TM1629_DIO_GPIO,
+    .DOUT = TM1629_DIO_GPIO,
+  },
+  .Host = TM1629_SPI_HOST,
+};
+#endif
 
 
 
@@ -59,101 +103,265 @@ TM1629_SetGPIO_IN_PU(gpio_num_t GPIO_Pad)
 
 
 static int8_t
-TM1629_PlatformInit_GPIO_3Wire(void)
+TM1629_PlatformInit_GPIO_3Wire(void *Context)
 {
-  TM1629_SetGPIO_OUT(TM1629_CLK_GPIO);
-  return TM1629_SetGPIO_OUT(TM1629_STB_GPIO);
+  TM1629_SetGPIO_OUT(TM1629_PINS(Context)->CLK);
+  return TM1629_SetGPIO_OUT(TM1629_PINS(Context)->STB);
 }
 
 static int8_t
-TM1629_PlatformDeInit_GPIO_3Wire(void)
+TM1629_PlatformDeInit_GPIO_3Wire(void *Context)
 {
-  gpio_reset_pin(TM1629_CLK_GPIO);
-  gpio_reset_pin(TM1629_STB_GPIO);
-  return gpio_reset_pin(TM1629_DIO_GPIO) == ESP_OK ? 0 : -1;
+  gpio_reset_pin(TM1629_PINS(Context)->CLK);
+  gpio_reset_pin(TM1629_PINS(Context)->STB);
+  return gpio_reset_pin(TM1629_PINS(Context)->DIN) == ESP_OK ? 0 : -1;
 }
 
 static int8_t
-TM1629_DirDIO_3Wire(uint8_t Dir)
+TM1629_DirDIO_3Wire(void *Context, uint8_t Dir)
 {
   if (Dir)
   {
-    return TM1629_SetGPIO_OUT(TM1629_DIO_GPIO);
+    return TM1629_SetGPIO_OUT(TM1629_PINS(Context)->DIN);
   }
 
-  return TM1629_SetGPIO_IN_PU(TM1629_DIO_GPIO);
+  return TM1629_SetGPIO_IN_PU(TM1629_PINS(Context)->DIN);
+}
+
+
+static int8_t
+TM1629_PlatformInit_GPIO_4Wire(void *Context)
+{
+  TM1629_SetGPIO_OUT(TM1629_PINS(Context)->CLK);
+  TM1629_SetGPIO_OUT(TM1629_PINS(Context)->STB);
+  TM1629_SetGPIO_OUT(TM1629_PINS(Context)->DIN);
+  return TM1629_SetGPIO_IN_PU(TM1629_PINS(Context)->DOUT);
 }
 
 static int8_t
-TM1629_WriteDIO_3Wire(uint8_t State)
+TM1629_PlatformDeInit_GPIO_4Wire(void *Context)
 {
-  return gpio_set_level(TM1629_DIO_GPIO, State) == ESP_OK ? 0 : -1;
+  gpio_reset_pin(TM1629_PINS(Context)->CLK);
+  gpio_reset_pin(TM1629_PINS(Context)->STB);
+  gpio_reset_pin(TM1629_PINS(Context)->DIN);
+  return gpio_reset_pin(TM1629_PINS(Context)->DOUT) == ESP_OK ? 0 : -1;
 }
 
 static int8_t
-TM1629_ReadDIO_3Wire(void)
+TM1629_DirDIO_4Wire(void *Context, uint8_t Dir)
 {
-  return gpio_get_level(TM1629_DIO_GPIO);
+  return 0;
 }
 
 
 static int8_t
-TM1629_PlatformInit_GPIO_4Wire(void)
+TM1629_WriteDIO(void *Context, uint8_t State)
 {
-  TM1629_SetGPIO_OUT(TM1629_CLK_GPIO);
-  TM1629_SetGPIO_OUT(TM1629_STB_GPIO);
-  TM1629_SetGPIO_OUT(TM1629_DIN_GPIO);
-  return TM1629_SetGPIO_IN_PU(TM1629_DOUT_GPIO);
+  return gpio_set_level(TM1629_PINS(Context)->DIN, State) == ESP_OK ? 0 : -1;
 }
 
 static int8_t
-TM1629_PlatformDeInit_GPIO_4Wire(void)
+TM1629_ReadDIO(void *Context)
 {
-  gpio_reset_pin(TM1629_CLK_GPIO);
-  gpio_reset_pin(TM1629_STB_GPIO);
-  gpio_reset_pin(TM1629_DIN_GPIO);
-  return gpio_reset_pin(TM1629_DOUT_GPIO) == ESP_OK ? 0 : -1;
+  return gpio_get_level(TM1629_PINS(Context)->DOUT);
 }
 
 
+#if (TM1629_CONFIG_SUPPORT_SPI)
 static int8_t
-TM1629_DirDIO_4Wire(uint8_t Dir)
+TM1629_PlatformInit_SPI(void *Context)
 {
+  TM1629_Platform_SPI_t *SPI = TM1629_SPI(Context);
+  spi_bus_config_t BusConfig = {0};
+  spi_device_interface_config_t DevConfig = {0};
+  esp_err_t Error = ESP_OK;
+
+  TM1629_SetGPIO_OUT(SPI->Pins.STB);
+
+  BusConfig.mosi_io_num = SPI->Pins.DIN;
+  BusConfig.miso_io_num = -1;
+  BusConfig.sclk_io_num = SPI->Pins.CLK;
+  BusConfig.quadwp_io_num = -1;
+  BusConfig.quadhd_io_num = -1;
+  BusConfig.max_transfer_sz = TM1629_FRAME_SIZE;
+
+  // The bus is already initialized if another handler uses the same host
+  Error = spi_bus_initialize(SPI->Host, &BusConfig, SPI_DMA_CH_AUTO);
+  if (Error != ESP_OK && Error != ESP_ERR_INVALID_STATE)
+    return -1;
+  SPI->BusOwner = (Error == ESP_OK);
+
+  DevConfig.mode = 3;
+  DevConfig.clock_speed_hz = TM1629_SPI_FREQ_HZ;
+  DevConfig.spics_io_num = -1;
+  DevConfig.queue_size = 1;
+  DevConfig.flags = SPI_DEVICE_3WIRE | SPI_DEVICE_HALFDUPLEX |
+                    SPI_DEVICE_BIT_LSBFIRST;
+  if (spi_bus_add_device(SPI->Host, &DevConfig, &SPI->Device) != ESP_OK)
+  {
+    if (SPI->BusOwner)
+      spi_bus_free(SPI->Host);
+    SPI->BusOwner = 0;
+    return -1;
+  }
+
+  // DIO is open-drain on TM1629 side while reading keys
+  return gpio_set_pull_mode(SPI->Pins.DIN, GPIO_PULLUP_ONLY) == ESP_OK ? 0 : -1;
+}
+
+static int8_t
+TM1629_PlatformDeInit_SPI(void *Context)
+{
+  TM1629_Platform_SPI_t *SPI = TM1629_SPI(Context);
+
+  spi_bus_remove_device(SPI->Device);
+  SPI->Device = NULL;
+  if (SPI->BusOwner)
+    spi_bus_free(SPI->Host);
+  SPI->BusOwner = 0;
+  gpio_reset_pin(SPI->Pins.STB);
   return 0;
 }
 
 static int8_t
-TM1629_WriteDIO_4Wire(uint8_t State)
+TM1629_SPIWrite(void *Context, const uint8_t *Data, uint8_t NumOfBytes)
 {
-  return gpio_set_level(TM1629_DIN_GPIO, State) == ESP_OK ? 0 : -1;
+  spi_transaction_t Transaction = {0};
+
+  Transaction.length = NumOfBytes * 8;
+  Transaction.tx_buffer = Data;
+  return spi_device_polling_transmit(TM1629_SPI(Context)->Device, &Transaction) == ESP_OK ? 0 : -1;
 }
 
 static int8_t
-TM1629_ReadDIO_4Wire(void)
+TM1629_SPIRead(void *Context, uint8_t *Data, uint8_t NumOfBytes)
 {
-  return gpio_get_level(TM1629_DOUT_GPIO);
+  spi_transaction_t Transaction = {0};
+
+  // tWAIT after read command
+  ets_delay_us(2);
+
+  Transaction.rxlength = NumOfBytes * 8;
+  Transaction.rx_buffer = Data;
+  return spi_device_polling_transmit(TM1629_SPI(Context)->Device, &Transaction) == ESP_OK ? 0 : -1;
 }
 
+static int8_t
+TM1629_WriteSTB_SPI(void *Context, uint8_t State)
+{
+  if (gpio_set_level(TM1629_SPI(Context)->Pins.STB, State) != ESP_OK)
+    return -1;
+
+  // tPW_STB before the next transaction (the driver does not wait in SPI mode)
+  if (State)
+    ets_delay_us(1);
+
+  return 0;
+}
+#endif
+
 
 static int8_t
-TM1629_WriteSTB(uint8_t State)
+TM1629_WriteSTB(void *Context, uint8_t State)
 {
-  return gpio_set_level(TM1629_STB_GPIO, State) == ESP_OK ? 0 : -1;
+  return gpio_set_level(TM1629_PINS(Context)->STB, State) == ESP_OK ? 0 : -1;
 }
 
 static int8_t
-TM1629_WriteCLK(uint8_t State)
+TM1629_WriteCLK(void *Context, uint8_t State)
 {
-  return gpio_set_level(TM1629_CLK_GPIO, State) == ESP_OK ? 0 : -1;
+  return gpio_set_level(TM1629_PINS(Context)->CLK, State) == ESP_OK ? 0 : -1;
 }
 
 static int8_t
-TM1629_DelayUs(uint8_t Delay)
+TM1629_DelayUs(void *Context, uint8_t Delay)
 {
   ets_delay_us(Delay);
   return 0;
 }
 
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+static uint32_t
+TM1629_GetTimeNs(void *Context)
+{
+  return (uint32_t)(esp_timer_get_time() * 1000);
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+static void
+TM1629_LinkMMIO(TM1629_Handler_t *Handler, const TM1629_Platform_Pins_t *Pins)
+{
+  TM1629_PLATFORM_SET_MMIO_REGS(Handler, NULL, NULL, NULL);
+
+  // Set/clear and input registers of the first bank cover GPIO0 to GPIO31
+  if (Pins->CLK >= 32 || Pins->STB >= 32 || Pins->DIN >= 32 || Pins->DOUT >= 32)
+    return;
+
+  TM1629_PLATFORM_SET_MMIO_REGS(Handler, (volatile uint32_t *)GPIO_OUT_W1TS_REG,
+                                (volatile uint32_t *)GPIO_OUT_W1TC_REG,
+                                (volatile const uint32_t *)GPIO_IN_REG);
+  TM1629_PLATFORM_SET_MMIO_PINS(Handler, 1ul << Pins->STB, 1ul << Pins->CLK,
+                                1ul << Pins->DIN, 1ul << Pins->DOUT);
+}
+#endif
+
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+/**
+ * @brief  Platform functions shared by all handlers of each interface (the
+ *         pins are in the context of each handler)
+ */
+static const TM1629_PlatformOps_t TM1629_Ops_3Wire =
+{
+  .Init = TM1629_PlatformInit_GPIO_3Wire,
+  .DeInit = TM1629_PlatformDeInit_GPIO_3Wire,
+  .WriteSTB = TM1629_WriteSTB,
+  .GPIO =
+  {
+    .DirDIO = TM1629_DirDIO_3Wire,
+    .WriteDIO = TM1629_WriteDIO,
+    .ReadDIO = TM1629_ReadDIO,
+    .WriteCLK = TM1629_WriteCLK,
+    .DelayUs = TM1629_DelayUs,
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+    .GetTimeNs = TM1629_GetTimeNs,
+#endif
+  },
+};
+
+static const TM1629_PlatformOps_t TM1629_Ops_4Wire =
+{
+  .Init = TM1629_PlatformInit_GPIO_4Wire,
+  .DeInit = TM1629_PlatformDeInit_GPIO_4Wire,
+  .WriteSTB = TM1629_WriteSTB,
+  .GPIO =
+  {
+    .DirDIO = TM1629_DirDIO_4Wire,
+    .WriteDIO = TM1629_WriteDIO,
+    .ReadDIO = TM1629_ReadDIO,
+    .WriteCLK = TM1629_WriteCLK,
+    .DelayUs = TM1629_DelayUs,
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+    .GetTimeNs = TM1629_GetTimeNs,
+#endif
+  },
+};
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+static const TM1629_PlatformOps_t TM1629_Ops_SPI =
+{
+  .Init = TM1629_PlatformInit_SPI,
+  .DeInit = TM1629_PlatformDeInit_SPI,
+  .WriteSTB = TM1629_WriteSTB_SPI,
+  .SPI =
+  {
+    .Write = TM1629_SPIWrite,
+    .Read = TM1629_SPIRead,
+  },
+};
+#endif
+#endif
+
 
 
 /**
@@ -165,37 +373,132 @@ TM1629_DelayUs(uint8_t Delay)
 /**
  * @brief  Initialize platform device to communicate TM1629 using 3-wire interface
  * @param  Handler: Pointer to handler
+ * @note   'TM1629_CLK_GPIO', 'TM1629_STB_GPIO' and 'TM1629_DIO_GPIO' are used.
  * @retval None
  */
 void
 TM1629_Platform_Init_GPIO_3Wire(TM1629_Handler_t *Handler)
+{
+  TM1629_Platform_Init_GPIO_3Wire_Pins(Handler, &TM1629_Pins_3Wire);
+}
+
+/**
+ * @brief  Initialize platform device to communicate TM1629 using 4-wire interface
+ * @param  Handler: Pointer to handler
+ * @note   'TM1629_CLK_GPIO', 'TM1629_STB_GPIO', 'TM1629_DIN_GPIO' and
+ *         'TM1629_DOUT_GPIO' are used.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_GPIO_4Wire(TM1629_Handler_t *Handler)
+{
+  TM1629_Platform_Init_GPIO_4Wire_Pins(Handler, &TM1629_Pins_4Wire);
+}
+
+/**
+ * @brief  Initialize platform device to communicate TM1629 using 3-wire interface
+ *         on custom pins
+ * @param  Handler: Pointer to handler
+ * @param  Pins: Pointer to IO pins. It must stay valid while the handler is used.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_GPIO_3Wire_Pins(TM1629_Handler_t *Handler,
+                                     const TM1629_Platform_Pins_t *Pins)
 {
   TM1629_PLATFORM_SET_COMMUNICATION(Handler, TM1629_COMMUNICATION_GPIO);
+  TM1629_PLATFORM_SET_CONTEXT(Handler, Pins);
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  TM1629_PLATFORM_LINK_OPS(Handler, &TM1629_Ops_3Wire);
+#else
   TM1629_PLATFORM_LINK_INIT(Handler, TM1629_PlatformInit_GPIO_3Wire);
   TM1629_PLATFORM_LINK_DEINIT(Handler, TM1629_PlatformDeInit_GPIO_3Wire);
   TM1629_PLATFORM_LINK_DIR_DIO(Handler, TM1629_DirDIO_3Wire);
-  TM1629_PLATFORM_LINK_WRITE_DIO(Handler, TM1629_WriteDIO_3Wire);
-  TM1629_PLATFORM_LINK_READ_DIO(Handler, TM1629_ReadDIO_3Wire);
+  TM1629_PLATFORM_LINK_WRITE_DIO(Handler, TM1629_WriteDIO);
+  TM1629_PLATFORM_LINK_READ_DIO(Handler, TM1629_ReadDIO);
   TM1629_PLATFORM_LINK_WRITE_STB(Handler, TM1629_WriteSTB);
   TM1629_PLATFORM_LINK_WRITE_CLK(Handler, TM1629_WriteCLK);
   TM1629_PLATFORM_LINK_DELAY_US(Handler, TM1629_DelayUs);
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+  TM1629_PLATFORM_LINK_GET_TIME_NS(Handler, TM1629_GetTimeNs);
+#endif
+#endif
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+  TM1629_LinkMMIO(Handler, Pins);
+#endif
 }
 
 /**
  * @brief  Initialize platform device to communicate TM1629 using 4-wire interface
+ *         on custom pins
  * @param  Handler: Pointer to handler
+ * @param  Pins: Pointer to IO pins. It must stay valid while the handler is used.
  * @retval None
  */
 void
-TM1629_Platform_Init_GPIO_4Wire(TM1629_Handler_t *Handler)
+TM1629_Platform_Init_GPIO_4Wire_Pins(TM1629_Handler_t *Handler,
+                                     const TM1629_Platform_Pins_t *Pins)
 {
   TM1629_PLATFORM_SET_COMMUNICATION(Handler, TM1629_COMMUNICATION_GPIO);
+  TM1629_PLATFORM_SET_CONTEXT(Handler, Pins);
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  TM1629_PLATFORM_LINK_OPS(Handler, &TM1629_Ops_4Wire);
+#else
   TM1629_PLATFORM_LINK_INIT(Handler, TM1629_PlatformInit_GPIO_4Wire);
   TM1629_PLATFORM_LINK_DEINIT(Handler, TM1629_PlatformDeInit_GPIO_4Wire);
   TM1629_PLATFORM_LINK_DIR_DIO(Handler, TM1629_DirDIO_4Wire);
-  TM1629_PLATFORM_LINK_WRITE_DIO(Handler, TM1629_WriteDIO_4Wire);
-  TM1629_PLATFORM_LINK_READ_DIO(Handler, TM1629_ReadDIO_4Wire);
+  TM1629_PLATFORM_LINK_WRITE_DIO(Handler, TM1629_WriteDIO);
+  TM1629_PLATFORM_LINK_READ_DIO(Handler, TM1629_ReadDIO);
   TM1629_PLATFORM_LINK_WRITE_STB(Handler, TM1629_WriteSTB);
   TM1629_PLATFORM_LINK_WRITE_CLK(Handler, TM1629_WriteCLK);
   TM1629_PLATFORM_LINK_DELAY_US(Handler, TM1629_DelayUs);
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+  TM1629_PLATFORM_LINK_GET_TIME_NS(Handler, TM1629_GetTimeNs);
+#endif
+#endif
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+  TM1629_LinkMMIO(Handler, Pins);
+#endif
+}
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+/**
+ * @brief  Initialize platform device to communicate TM1629 using SPI host
+ * @param  Handler: Pointer to handler
+ * @note   'TM1629_SPI_HOST', 'TM1629_CLK_GPIO', 'TM1629_STB_GPIO' and
+ *         'TM1629_DIO_GPIO' are used, so only one handler can use this
+ *         function. Use TM1629_Platform_Init_SPI_Host for more.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_SPI(TM1629_Handler_t *Handler)
+{
+  TM1629_Platform_Init_SPI_Host(Handler, &TM1629_SPI_Default);
+}
+
+/**
+ * @brief  Initialize platform device to communicate TM1629 using SPI host on
+ *         custom pins
+ * @param  Handler: Pointer to handler
+ * @param  SPI: Pointer to SPI interface ('Pins' and 'Host' must be set). It
+ *              must stay valid while the handler is used.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_SPI_Host(TM1629_Handler_t *Handler,
+                              TM1629_Platform_SPI_t *SPI)
+{
+  TM1629_PLATFORM_SET_COMMUNICATION(Handler, TM1629_COMMUNICATION_SPI);
+  TM1629_PLATFORM_SET_CONTEXT(Handler, SPI);
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  TM1629_PLATFORM_LINK_OPS(Handler, &TM1629_Ops_SPI);
+#else
+  TM1629_PLATFORM_LINK_INIT(Handler, TM1629_PlatformInit_SPI);
+  TM1629_PLATFORM_LINK_DEINIT(Handler, TM1629_PlatformDeInit_SPI);
+  TM1629_PLATFORM_LINK_WRITE_STB(Handler, TM1629_WriteSTB_SPI);
+  TM1629_PLATFORM_LINK_SPI_WRITE(Handler, TM1629_SPIWrite);
+  TM1629_PLATFORM_LINK_SPI_READ(Handler, TM1629_SPIRead);
+#endif
+  TM1629_PLATFORM_SET_SPI_MSB_FIRST(Handler, 0);
 }
+#endif
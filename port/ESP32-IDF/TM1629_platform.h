@@ -40,6 +40,10 @@ extern "C" {
 /* Includes ---------------------------------------------------------------------*/
 #include "TM1629.h"
 #include <stdint.h>
+#include "driver/gpio.h"
+#if (TM1629_CONFIG_SUPPORT_SPI)
+#include "driver/spi_master.h"
+#endif
 
 
 /* Functionality Options --------------------------------------------------------*/
@@ -57,6 +61,53 @@ extern "C" {
 #define TM1629_DOUT_GPIO    GPIO_NUM_19
 #define TM1629_DIO_GPIO     GPIO_NUM_23
 
+/**
+ * @brief  Specify SPI host and clock frequency used for SPI communication
+ * @note   In SPI mode, CLK and DIO of TM1629 are driven by the SPI host using
+ *         'TM1629_CLK_GPIO' and 'TM1629_DIO_GPIO' pins. STB is driven manually
+ *         through 'TM1629_STB_GPIO'.
+ */
+#define TM1629_SPI_HOST     SPI2_HOST
+#define TM1629_SPI_FREQ_HZ  1000000
+
+
+
+/* Exported Data Types ----------------------------------------------------------*/
+/**
+ * @brief  IO pins of one TM1629 (used as context of platform functions)
+ * @note   In 3-wire interface, set 'DIN' and 'DOUT' to the same GPIO pin.
+ * @note   Several handlers can share CLK and DIN/DOUT pins as long as each one
+ *         has its own STB pin.
+ */
+typedef struct TM1629_Platform_Pins_s
+{
+  gpio_num_t CLK;
+  gpio_num_t STB;
+  gpio_num_t DIN;
+  gpio_num_t DOUT;
+} TM1629_Platform_Pins_t;
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+/**
+ * @brief  SPI interface of one TM1629 (used as context of platform functions)
+ * @note   'Pins.DIN' is the data line of the SPI host and 'Pins.DOUT' is not
+ *         used.
+ * @note   Several handlers can share one SPI host (same CLK and DIN pins) as
+ *         long as each one has its own STB pin. The first initialized handler
+ *         initializes the bus and frees it at de-initialization, so it must be
+ *         de-initialized last.
+ */
+typedef struct TM1629_Platform_SPI_s
+{
+  TM1629_Platform_Pins_t Pins;
+  spi_host_device_t Host;
+
+  // Managed by the port
+  spi_device_handle_t Device;
+  uint8_t BusOwner;
+} TM1629_Platform_SPI_t;
+#endif
+
 
 
 /**
@@ -68,6 +119,7 @@ extern "C" {
 /**
  * @brief  Initialize platform device to communicate TM1629 using 3-wire interface
  * @param  Handler: Pointer to handler
+ * @note   'TM1629_CLK_GPIO', 'TM1629_STB_GPIO' and 'TM1629_DIO_GPIO' are used.
  * @retval None
  */
 void
@@ -77,12 +129,65 @@ TM1629_Platform_Init_GPIO_3Wire(TM1629_Handler_t *Handler);
 /**
  * @brief  Initialize platform device to communicate TM1629 using 4-wire interface
  * @param  Handler: Pointer to handler
+ * @note   'TM1629_CLK_GPIO', 'TM1629_STB_GPIO', 'TM1629_DIN_GPIO' and
+ *         'TM1629_DOUT_GPIO' are used.
  * @retval None
  */
 void
 TM1629_Platform_Init_GPIO_4Wire(TM1629_Handler_t *Handler);
 
 
+/**
+ * @brief  Initialize platform device to communicate TM1629 using 3-wire interface
+ *         on custom pins
+ * @param  Handler: Pointer to handler
+ * @param  Pins: Pointer to IO pins. It must stay valid while the handler is used.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_GPIO_3Wire_Pins(TM1629_Handler_t *Handler,
+                                     const TM1629_Platform_Pins_t *Pins);
+
+
+/**
+ * @brief  Initialize platform device to communicate TM1629 using 4-wire interface
+ *         on custom pins
+ * @param  Handler: Pointer to handler
+ * @param  Pins: Pointer to IO pins. It must stay valid while the handler is used.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_GPIO_4Wire_Pins(TM1629_Handler_t *Handler,
+                                     const TM1629_Platform_Pins_t *Pins);
+
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+/**
+ * @brief  Initialize platform device to communicate TM1629 using SPI host
+ * @param  Handler: Pointer to handler
+ * @note   'TM1629_SPI_HOST', 'TM1629_CLK_GPIO', 'TM1629_STB_GPIO' and
+ *         'TM1629_DIO_GPIO' are used, so only one handler can use this
+ *         function. Use TM1629_Platform_Init_SPI_Host for more.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_SPI(TM1629_Handler_t *Handler);
+
+
+/**
+ * @brief  Initialize platform device to communicate TM1629 using SPI host on
+ *         custom pins
+ * @param  Handler: Pointer to handler
+ * @param  SPI: Pointer to SPI interface ('Pins' and 'Host' must be set). It
+ *              must stay valid while the handler is used.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_SPI_Host(TM1629_Handler_t *Handler,
+                              TM1629_Platform_SPI_t *SPI);
+#endif
+
+
 
 #ifdef __cplusplus
 }
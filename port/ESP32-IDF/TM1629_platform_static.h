@@ -0,0 +1,117 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_platform_static.h
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Compile-time bound GPIO functions of the ESP32 platform layer
+ *         (TM1629_CONFIG_STATIC_PLATFORM)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+  
+/* Define to prevent recursive inclusion ----------------------------------------*/
+#ifndef _TM1629_PLATFORM_STATIC_H_
+#define _TM1629_PLATFORM_STATIC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629_platform.h"
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
+#include "rom/ets_sys.h"
+
+
+/* Functionality Options --------------------------------------------------------*/
+/**
+ * @brief  Specify DIO pins written and read by the bound functions
+ * @note   Use 'TM1629_DIN_GPIO' and 'TM1629_DOUT_GPIO' for 4-wire interface.
+ * @note   All pins must be below GPIO32 (first bank of set/clear registers).
+ *         The pins are configured by the Init function linked by
+ *         TM1629_Platform_Init_GPIO_3Wire or TM1629_Platform_Init_GPIO_4Wire.
+ */
+#define TM1629_STATIC_DIN_GPIO    TM1629_DIO_GPIO
+#define TM1629_STATIC_DOUT_GPIO   TM1629_DIO_GPIO
+
+
+
+/**
+ ==================================================================================
+                               ##### Functions #####
+ ==================================================================================
+ */
+
+static inline int8_t
+TM1629_Static_WritePin(uint32_t Pin, uint8_t State)
+{
+  REG_WRITE(State ? GPIO_OUT_W1TS_REG : GPIO_OUT_W1TC_REG, 1ul << Pin);
+  return 0;
+}
+
+static inline int8_t
+TM1629_Static_ReadDIO(void)
+{
+  return (REG_READ(GPIO_IN_REG) >> TM1629_STATIC_DOUT_GPIO) & 0x01;
+}
+
+static inline int8_t
+TM1629_Static_DirDIO(uint8_t Dir)
+{
+  // DIN and DOUT pins of 4-wire interface keep their direction
+  if (TM1629_STATIC_DIN_GPIO != TM1629_STATIC_DOUT_GPIO)
+    return 0;
+
+  if (Dir)
+    return gpio_set_direction(TM1629_STATIC_DIN_GPIO, GPIO_MODE_OUTPUT) == ESP_OK ? 0 : -1;
+
+  gpio_set_direction(TM1629_STATIC_DIN_GPIO, GPIO_MODE_INPUT);
+  return gpio_set_pull_mode(TM1629_STATIC_DIN_GPIO, GPIO_PULLUP_ONLY) == ESP_OK ? 0 : -1;
+}
+
+static inline int8_t
+TM1629_Static_DelayNs(uint16_t Delay)
+{
+  ets_delay_us((Delay + 999) / 1000);
+  return 0;
+}
+
+
+
+/* Bound Functions --------------------------------------------------------------*/
+#define TM1629_PORT_WRITE_STB(CONTEXT, STATE)  TM1629_Static_WritePin(TM1629_STB_GPIO, STATE)
+#define TM1629_PORT_WRITE_CLK(CONTEXT, STATE)  TM1629_Static_WritePin(TM1629_CLK_GPIO, STATE)
+#define TM1629_PORT_WRITE_DIO(CONTEXT, STATE)  TM1629_Static_WritePin(TM1629_STATIC_DIN_GPIO, STATE)
+#define TM1629_PORT_READ_DIO(CONTEXT)          TM1629_Static_ReadDIO()
+#define TM1629_PORT_DIR_DIO(CONTEXT, DIR)      TM1629_Static_DirDIO(DIR)
+#define TM1629_PORT_DELAY_NS(CONTEXT, DELAY)   TM1629_Static_DelayNs(DELAY)
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //! _TM1629_PLATFORM_STATIC_H_
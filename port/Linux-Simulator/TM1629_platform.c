@@ -0,0 +1,754 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_platform.c
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  A simulated TM1629 as Platform dependent layer for TM1629 Driver
+ *         (host side, Linux)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629_platform.h"
+#include <string.h>
+
+
+/* Private Constants ------------------------------------------------------------*/
+/**
+ * @brief  Instruction set of TM1629 (same as the driver)
+ */
+#define COMMAND_MASK                                0xC0
+#define COMMAND_DATA_READING_WRITING_SETTING        0x40
+#define COMMAND_DISPLAY_CONTROL                     0x80
+#define COMMAND_ADDRESS_SETTING                     0xC0
+
+#define COMMAND_DRWS_READ_KEY_SCANNING_DATA         0x02
+#define COMMAND_DRWS_FIXED_ADDRESS                  0x04
+
+#define COMMAND_DC_DISPLAY_IS_ON                    0x08
+
+
+
+/* Private Macros ---------------------------------------------------------------*/
+#define TM1629_SIM(CONTEXT)  ((TM1629_Sim_t *)(CONTEXT))
+#define TM1629_SIM_WIDE_BUS(CONTEXT)  ((TM1629_Sim_WideBus_t *)(CONTEXT))
+
+
+
+/* Private variables ------------------------------------------------------------*/
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+/**
+ * @brief  Simulated chips owning the registers seen by the MMIO hooks
+ */
+static TM1629_Sim_t *TM1629_Sim_MMIOChips[TM1629_SIM_MMIO_MAX_CHIPS];
+#endif
+
+
+
+/**
+ ==================================================================================
+                           ##### Private Functions #####
+ ==================================================================================
+ */
+
+static void
+TM1629_Sim_ReceiveByte(TM1629_Sim_t *Sim, uint8_t Data)
+{
+  Sim->BytesWritten++;
+
+  // Data bytes following an address setting command
+  if (Sim->NumOfBytes++)
+  {
+    Sim->DisplayRAM[Sim->Address] = Data;
+    if (!(Sim->DataCommand & COMMAND_DRWS_FIXED_ADDRESS))
+      Sim->Address = (Sim->Address + 1) & 0x0F;
+    return;
+  }
+
+  switch (Data & COMMAND_MASK)
+  {
+  case COMMAND_DATA_READING_WRITING_SETTING:
+    Sim->DataCommand = Data;
+    if (Data & COMMAND_DRWS_READ_KEY_SCANNING_DATA)
+    {
+      Sim->Reading = 1;
+      Sim->ReadBit = 0;
+    }
+    break;
+
+  case COMMAND_DISPLAY_CONTROL:
+    Sim->DisplayControl = Data;
+    break;
+
+  case COMMAND_ADDRESS_SETTING:
+    Sim->Address = Data & 0x0F;
+    break;
+
+  default:
+    Sim->Errors++;
+    break;
+  }
+}
+
+
+int8_t
+TM1629_Sim_DirDIO(void *Context, uint8_t Dir)
+{
+  TM1629_SIM(Context)->Calls++;
+  TM1629_SIM(Context)->DirDIO = Dir;
+  TM1629_SIM(Context)->DirChanges++;
+  return 0;
+}
+
+static void
+TM1629_Sim_DriveDIO(TM1629_Sim_t *Sim, uint8_t State)
+{
+  State = State ? 1 : 0;
+  if (Sim->DIO != State)
+    Sim->EdgesDIO++;
+  Sim->DIO = State;
+}
+
+int8_t
+TM1629_Sim_WriteDIO(void *Context, uint8_t State)
+{
+  TM1629_Sim_t *Sim = TM1629_SIM(Context);
+
+  Sim->Calls++;
+  Sim->PinWrites++;
+  TM1629_Sim_DriveDIO(Sim, State);
+  return 0;
+}
+
+static uint8_t
+TM1629_Sim_LevelDIO(TM1629_Sim_t *Sim)
+{
+  if (Sim->Reading && !Sim->STB)
+    return Sim->OutBit;
+
+  // Pulled up while nobody drives DIO
+  return Sim->DirDIO ? Sim->DIO : 1;
+}
+
+int8_t
+TM1629_Sim_ReadDIO(void *Context)
+{
+  TM1629_SIM(Context)->Calls++;
+  return TM1629_Sim_LevelDIO(TM1629_SIM(Context));
+}
+
+static void
+TM1629_Sim_DriveSTB(TM1629_Sim_t *Sim, uint8_t State)
+{
+  State = State ? 1 : 0;
+  if (Sim->STB == State)
+    return;
+
+  Sim->EdgesSTB++;
+  Sim->STB = State;
+
+  if (!State)
+  {
+    Sim->Shift = 0;
+    Sim->NumOfBits = 0;
+    Sim->NumOfBytes = 0;
+    Sim->Reading = 0;
+    Sim->OutBit = 1;
+    return;
+  }
+
+  if (Sim->NumOfBits)
+    Sim->Errors++;
+
+  Sim->Reading = 0;
+  Sim->Transactions++;
+}
+
+int8_t
+TM1629_Sim_WriteSTB(void *Context, uint8_t State)
+{
+  TM1629_Sim_t *Sim = TM1629_SIM(Context);
+
+  Sim->Calls++;
+  Sim->PinWrites++;
+  TM1629_Sim_DriveSTB(Sim, State);
+  return 0;
+}
+
+static void
+TM1629_Sim_DriveCLK(TM1629_Sim_t *Sim, uint8_t State)
+{
+  State = State ? 1 : 0;
+  if (Sim->CLK == State)
+    return;
+
+  Sim->EdgesCLK++;
+  Sim->CLK = State;
+
+  if (Sim->STB)
+    return;
+
+  if (Sim->Reading)
+  {
+    // Key data goes out on falling edges, DIO must be released by the driver
+    if (!State && Sim->ReadBit < 32)
+    {
+      Sim->OutBit = (Sim->KeyRegs[Sim->ReadBit >> 3] >> (Sim->ReadBit & 0x07)) & 0x01;
+      if ((++Sim->ReadBit & 0x07) == 0)
+        Sim->BytesRead++;
+    }
+    if (State && Sim->DirDIO)
+      Sim->Errors++;
+    return;
+  }
+
+  if (!State)
+    return;
+
+  if (!Sim->DirDIO)
+    Sim->Errors++;
+
+  Sim->Shift |= (Sim->DIO << Sim->NumOfBits);
+  if (++Sim->NumOfBits == 8)
+  {
+    TM1629_Sim_ReceiveByte(Sim, Sim->Shift);
+    Sim->Shift = 0;
+    Sim->NumOfBits = 0;
+  }
+}
+
+int8_t
+TM1629_Sim_WriteCLK(void *Context, uint8_t State)
+{
+  TM1629_Sim_t *Sim = TM1629_SIM(Context);
+
+  Sim->Calls++;
+  Sim->PinWrites++;
+  TM1629_Sim_DriveCLK(Sim, State);
+  return 0;
+}
+
+static int8_t
+TM1629_Sim_DelayUs(void *Context, uint8_t Delay)
+{
+  TM1629_SIM(Context)->Calls++;
+  TM1629_SIM(Context)->TimeNs += (uint64_t)Delay * 1000;
+  return 0;
+}
+
+int8_t
+TM1629_Sim_DelayNs(void *Context, uint16_t Delay)
+{
+  TM1629_SIM(Context)->Calls++;
+  TM1629_SIM(Context)->TimeNs += Delay;
+  return 0;
+}
+
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+static void
+TM1629_Sim_DrivePort(TM1629_Sim_t *Sim, uint32_t Mask, uint8_t State)
+{
+  Sim->RegisterWrites++;
+
+  // STB frames the other pins driven by the same store
+  if (!State && (Mask & TM1629_SIM_PORT_STB_MASK))
+    TM1629_Sim_DriveSTB(Sim, State);
+  if (Mask & TM1629_SIM_PORT_DIO_MASK)
+    TM1629_Sim_DriveDIO(Sim, State);
+  if (Mask & TM1629_SIM_PORT_CLK_MASK)
+    TM1629_Sim_DriveCLK(Sim, State);
+  if (State && (Mask & TM1629_SIM_PORT_STB_MASK))
+    TM1629_Sim_DriveSTB(Sim, State);
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+/**
+ * @brief  Level of a pin in a port word (0xFF: Not changed)
+ */
+static uint8_t
+TM1629_Sim_WordLevel(TM1629_Sim_t *Sim, uint32_t Word, uint32_t Mask)
+{
+  if (Sim->WaveformFormat == TM1629_WAVEFORM_FORMAT_SET_RESET)
+  {
+    if (Word & Mask)
+      return 1;
+    return (Word & (Mask << 16)) ? 0 : 0xFF;
+  }
+
+  return (Word & Mask) ? 1 : 0;
+}
+
+static int8_t
+TM1629_Sim_PlayWaveform(void *Context, const uint32_t *Words, uint16_t NumOfWords)
+{
+  TM1629_Sim_t *Sim = TM1629_SIM(Context);
+  uint8_t STB = 0, CLK = 0, DIO = 0;
+
+  Sim->Calls++;
+  Sim->Waveforms++;
+
+  for (uint16_t i = 0; i < NumOfWords; i++)
+  {
+    STB = TM1629_Sim_WordLevel(Sim, Words[i], TM1629_SIM_PORT_STB_MASK);
+    CLK = TM1629_Sim_WordLevel(Sim, Words[i], TM1629_SIM_PORT_CLK_MASK);
+    DIO = TM1629_Sim_WordLevel(Sim, Words[i], TM1629_SIM_PORT_DIO_MASK);
+
+    // Pins of one word change together, STB frames the other ones
+    if (STB == 0)
+      TM1629_Sim_DriveSTB(Sim, STB);
+    if (DIO != 0xFF)
+      TM1629_Sim_DriveDIO(Sim, DIO);
+    if (CLK != 0xFF)
+      TM1629_Sim_DriveCLK(Sim, CLK);
+    if (STB == 1)
+      TM1629_Sim_DriveSTB(Sim, STB);
+
+    Sim->WaveformWords++;
+    Sim->TimeNs += TM1629_SIM_WAVEFORM_TICK_NS;
+  }
+
+  return 0;
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+static int8_t
+TM1629_Sim_WideBus_WriteSTB(void *Context, uint8_t State)
+{
+  TM1629_Sim_WideBus_t *Port = TM1629_SIM_WIDE_BUS(Context);
+
+  for (uint8_t n = 0; n < Port->NumOfChips; n++)
+    TM1629_Sim_WriteSTB(Port->Chips[n], State);
+  return 0;
+}
+
+static int8_t
+TM1629_Sim_WideBus_WriteCLK(void *Context, uint8_t State)
+{
+  TM1629_Sim_WideBus_t *Port = TM1629_SIM_WIDE_BUS(Context);
+
+  for (uint8_t n = 0; n < Port->NumOfChips; n++)
+    TM1629_Sim_WriteCLK(Port->Chips[n], State);
+  return 0;
+}
+
+static int8_t
+TM1629_Sim_WideBus_WritePort(void *Context, uint32_t Mask, uint32_t Value)
+{
+  TM1629_Sim_WideBus_t *Port = TM1629_SIM_WIDE_BUS(Context);
+  uint8_t WriteCLK = (Mask & Port->CLKMask) ? 1 : 0;
+  uint8_t CLK = (Value & Port->CLKMask) ? 1 : 0;
+  TM1629_Sim_t *Sim = NULL;
+
+  for (uint8_t n = 0; n < Port->NumOfChips; n++)
+  {
+    Sim = Port->Chips[n];
+
+    // Pins of one write change together: a falling CLK never samples the new
+    // DIO level and a rising one always does
+    if (WriteCLK && !CLK)
+      TM1629_Sim_WriteCLK(Sim, 0);
+    if (Mask & Port->DIOMask[n])
+      TM1629_Sim_WriteDIO(Sim, (Value & Port->DIOMask[n]) ? 1 : 0);
+    if (WriteCLK && CLK)
+      TM1629_Sim_WriteCLK(Sim, 1);
+  }
+
+  return 0;
+}
+
+static int8_t
+TM1629_Sim_WideBus_ReadPort(void *Context, uint32_t *Value)
+{
+  TM1629_Sim_WideBus_t *Port = TM1629_SIM_WIDE_BUS(Context);
+
+  *Value = 0;
+  for (uint8_t n = 0; n < Port->NumOfChips; n++)
+  {
+    if (TM1629_Sim_ReadDIO(Port->Chips[n]))
+      *Value |= Port->DIOMask[n];
+  }
+
+  return 0;
+}
+
+static int8_t
+TM1629_Sim_WideBus_DirPort(void *Context, uint32_t Mask, uint8_t Dir)
+{
+  TM1629_Sim_WideBus_t *Port = TM1629_SIM_WIDE_BUS(Context);
+
+  for (uint8_t n = 0; n < Port->NumOfChips; n++)
+  {
+    if (Mask & Port->DIOMask[n])
+      TM1629_Sim_DirDIO(Port->Chips[n], Dir);
+  }
+
+  return 0;
+}
+
+static int8_t
+TM1629_Sim_WideBus_DelayNs(void *Context, uint16_t Delay)
+{
+  TM1629_Sim_WideBus_t *Port = TM1629_SIM_WIDE_BUS(Context);
+
+  for (uint8_t n = 0; n < Port->NumOfChips; n++)
+    TM1629_Sim_DelayNs(Port->Chips[n], Delay);
+  return 0;
+}
+#endif
+
+
+/**
+ ==================================================================================
+                            ##### Public Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Reset simulated chip (display RAM, commands and statistics)
+ * @param  Sim: Pointer to simulated chip
+ * @retval None
+ */
+void
+TM1629_Sim_Reset(TM1629_Sim_t *Sim)
+{
+  memset(Sim, 0, sizeof(TM1629_Sim_t));
+  Sim->STB = 1;
+  Sim->CLK = 1;
+  Sim->DIO = 1;
+  Sim->DirDIO = 1;
+  Sim->OutBit = 1;
+}
+
+/**
+ * @brief  Reset virtual time and statistics of simulated chip
+ * @param  Sim: Pointer to simulated chip
+ * @retval None
+ */
+void
+TM1629_Sim_ResetStats(TM1629_Sim_t *Sim)
+{
+  Sim->TimeNs = 0;
+  Sim->EdgesSTB = 0;
+  Sim->EdgesCLK = 0;
+  Sim->EdgesDIO = 0;
+  Sim->PinWrites = 0;
+  Sim->DirChanges = 0;
+  Sim->Calls = 0;
+  Sim->Transactions = 0;
+  Sim->BytesWritten = 0;
+  Sim->BytesRead = 0;
+  Sim->Errors = 0;
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+  Sim->RegisterWrites = 0;
+#endif
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+  Sim->Waveforms = 0;
+  Sim->WaveformWords = 0;
+#endif
+}
+
+/**
+ * @brief  Set pressed keys of simulated chip
+ * @param  Sim: Pointer to simulated chip
+ * @param  Keys: Pressed keys in the format returned by TM1629_ScanKeys
+ * @retval None
+ */
+void
+TM1629_Sim_SetKeys(TM1629_Sim_t *Sim, uint32_t Keys)
+{
+  uint8_t Kn = 0x01;
+
+  memset(Sim->KeyRegs, 0, sizeof(Sim->KeyRegs));
+
+  // Reverse of the key decoding of TM1629_ScanKeys (MSB is decoded first)
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    for (int8_t j = 3; j >= 0; j--)
+    {
+      if (Keys & 0x80000000)
+        Sim->KeyRegs[j] |= (Kn << 4);
+      Keys <<= 1;
+
+      if (Keys & 0x80000000)
+        Sim->KeyRegs[j] |= Kn;
+      Keys <<= 1;
+    }
+
+    Kn <<= 1;
+  }
+}
+
+/**
+ * @brief  Get brightness level of simulated chip
+ * @param  Sim: Pointer to simulated chip
+ * @retval Brightness level (0 to 7), -1 if the display is OFF
+ */
+int8_t
+TM1629_Sim_GetBrightness(const TM1629_Sim_t *Sim)
+{
+  if (!(Sim->DisplayControl & COMMAND_DC_DISPLAY_IS_ON))
+    return -1;
+
+  return Sim->DisplayControl & 0x07;
+}
+
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+/**
+ * @brief  Platform functions shared by the handlers of simulated chips
+ */
+static const TM1629_PlatformOps_t TM1629_Sim_Ops =
+{
+  .WriteSTB = TM1629_Sim_WriteSTB,
+  .GPIO =
+  {
+    .DirDIO = TM1629_Sim_DirDIO,
+    .WriteDIO = TM1629_Sim_WriteDIO,
+    .ReadDIO = TM1629_Sim_ReadDIO,
+    .WriteCLK = TM1629_Sim_WriteCLK,
+    .DelayUs = TM1629_Sim_DelayUs,
+    .DelayNs = TM1629_Sim_DelayNs,
+  },
+};
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+static const TM1629_PlatformOps_t TM1629_Sim_WaveformOps =
+{
+  .WriteSTB = TM1629_Sim_WriteSTB,
+  .GPIO =
+  {
+    .DirDIO = TM1629_Sim_DirDIO,
+    .WriteDIO = TM1629_Sim_WriteDIO,
+    .ReadDIO = TM1629_Sim_ReadDIO,
+    .WriteCLK = TM1629_Sim_WriteCLK,
+    .DelayUs = TM1629_Sim_DelayUs,
+    .DelayNs = TM1629_Sim_DelayNs,
+    .Waveform = { .Play = TM1629_Sim_PlayWaveform },
+  },
+};
+#endif
+#endif
+
+/**
+ * @brief  Initialize platform device to communicate a simulated TM1629
+ * @param  Handler: Pointer to handler
+ * @param  Sim: Pointer to simulated chip. It must stay valid while the handler
+ *              is used.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_Sim(TM1629_Handler_t *Handler, TM1629_Sim_t *Sim)
+{
+  TM1629_PLATFORM_SET_COMMUNICATION(Handler, TM1629_COMMUNICATION_GPIO);
+  TM1629_PLATFORM_SET_CONTEXT(Handler, Sim);
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  TM1629_PLATFORM_LINK_OPS(Handler, &TM1629_Sim_Ops);
+#else
+  TM1629_PLATFORM_LINK_DIR_DIO(Handler, TM1629_Sim_DirDIO);
+  TM1629_PLATFORM_LINK_WRITE_DIO(Handler, TM1629_Sim_WriteDIO);
+  TM1629_PLATFORM_LINK_READ_DIO(Handler, TM1629_Sim_ReadDIO);
+  TM1629_PLATFORM_LINK_WRITE_STB(Handler, TM1629_Sim_WriteSTB);
+  TM1629_PLATFORM_LINK_WRITE_CLK(Handler, TM1629_Sim_WriteCLK);
+  TM1629_PLATFORM_LINK_DELAY_US(Handler, TM1629_Sim_DelayUs);
+  TM1629_PLATFORM_LINK_DELAY_NS(Handler, TM1629_Sim_DelayNs);
+#endif
+}
+
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+/**
+ * @brief  Let the driver access a simulated TM1629 through the registers of a
+ *         simulated GPIO port (call after TM1629_Platform_Init_Sim)
+ * @param  Handler: Pointer to handler
+ * @param  Sim: Pointer to simulated chip
+ * @note   Register accesses only reach the chip through the MMIO hooks (see
+ *         TM1629_platform.h).
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: Too many simulated chips ('TM1629_SIM_MMIO_MAX_CHIPS').
+ */
+int8_t
+TM1629_Platform_Init_Sim_MMIO(TM1629_Handler_t *Handler, TM1629_Sim_t *Sim)
+{
+  uint8_t i = 0;
+
+  for (i = 0; i < TM1629_SIM_MMIO_MAX_CHIPS; i++)
+  {
+    if (TM1629_Sim_MMIOChips[i] == Sim || !TM1629_Sim_MMIOChips[i])
+      break;
+  }
+
+  if (i == TM1629_SIM_MMIO_MAX_CHIPS)
+    return -1;
+
+  TM1629_Sim_MMIOChips[i] = Sim;
+  TM1629_PLATFORM_SET_MMIO_REGS(Handler, &Sim->PortSet, &Sim->PortClear,
+                                &Sim->PortInput);
+  TM1629_PLATFORM_SET_MMIO_PINS(Handler, TM1629_SIM_PORT_STB_MASK,
+                                TM1629_SIM_PORT_CLK_MASK,
+                                TM1629_SIM_PORT_DIO_MASK,
+                                TM1629_SIM_PORT_DIO_MASK);
+  return 0;
+}
+
+/**
+ * @brief  Store to a register (hook of TM1629_CONFIG_MMIO_STORE)
+ * @param  Reg: Pointer to register. Set and clear registers of simulated
+ *              chips drive their pins, other registers are written as is.
+ * @param  Value: Value to store
+ * @retval None
+ */
+void
+TM1629_Sim_MMIOStore(volatile uint32_t *Reg, uint32_t Value)
+{
+  TM1629_Sim_t *Sim = NULL;
+
+  for (uint8_t i = 0; i < TM1629_SIM_MMIO_MAX_CHIPS && TM1629_Sim_MMIOChips[i]; i++)
+  {
+    Sim = TM1629_Sim_MMIOChips[i];
+    if (Reg == &Sim->PortSet || Reg == &Sim->PortClear)
+    {
+      TM1629_Sim_DrivePort(Sim, Value, Reg == &Sim->PortSet);
+      return;
+    }
+  }
+
+  *Reg = Value;
+}
+
+/**
+ * @brief  Load from a register (hook of TM1629_CONFIG_MMIO_LOAD)
+ * @param  Reg: Pointer to register. Input registers of simulated chips return
+ *              the DIO level, other registers are read as is.
+ * @retval Value of the register
+ */
+uint32_t
+TM1629_Sim_MMIOLoad(volatile const uint32_t *Reg)
+{
+  TM1629_Sim_t *Sim = NULL;
+
+  for (uint8_t i = 0; i < TM1629_SIM_MMIO_MAX_CHIPS && TM1629_Sim_MMIOChips[i]; i++)
+  {
+    Sim = TM1629_Sim_MMIOChips[i];
+    if (Reg == &Sim->PortInput)
+      return TM1629_Sim_LevelDIO(Sim) ? TM1629_SIM_PORT_DIO_MASK : 0;
+  }
+
+  return *Reg;
+}
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+/**
+ * @brief  Let the driver send write transactions to a simulated TM1629 as
+ *         compiled waveforms (call after TM1629_Platform_Init_Sim)
+ * @param  Handler: Pointer to handler
+ * @param  Sim: Pointer to simulated chip
+ * @param  Buffer: Buffer of compiled waveform
+ * @param  Size: Size of the buffer in words
+ * @param  Format: Format of port words (TM1629_WaveformFormat_t)
+ * @retval None
+ */
+void
+TM1629_Platform_Init_Sim_Waveform(TM1629_Handler_t *Handler, TM1629_Sim_t *Sim,
+                                  uint32_t *Buffer, uint16_t Size,
+                                  TM1629_WaveformFormat_t Format)
+{
+  Sim->WaveformFormat = Format;
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  TM1629_PLATFORM_LINK_OPS(Handler, &TM1629_Sim_WaveformOps);
+#else
+  TM1629_PLATFORM_LINK_PLAY_WAVEFORM(Handler, TM1629_Sim_PlayWaveform);
+#endif
+  TM1629_PLATFORM_SET_WAVEFORM_BUFFER(Handler, Buffer, Size,
+                                      TM1629_SIM_WAVEFORM_TICK_NS);
+  TM1629_PLATFORM_SET_WAVEFORM_PINS(Handler, Format,
+                                    TM1629_SIM_PORT_STB_MASK,
+                                    TM1629_SIM_PORT_CLK_MASK,
+                                    TM1629_SIM_PORT_DIO_MASK, 0);
+}
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Initialize wide bus on a simulated GPIO port
+ * @param  Bus: Pointer to wide bus
+ * @param  Port: Pointer to simulated port. It must stay valid while the bus is
+ *               used.
+ * @param  CLKMask: CLK pin on the port (0: CLK is written by WriteCLK)
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: TM1629_WideBus_Init failed.
+ */
+int8_t
+TM1629_Platform_Init_Sim_WideBus(TM1629_WideBus_t *Bus,
+                                 TM1629_Sim_WideBus_t *Port, uint32_t CLKMask)
+{
+  memset(Port, 0, sizeof(TM1629_Sim_WideBus_t));
+  Port->CLKMask = CLKMask;
+
+  Bus->Context = Port;
+  Bus->CLKMask = CLKMask;
+  Bus->WriteSTB = TM1629_Sim_WideBus_WriteSTB;
+  Bus->WriteCLK = TM1629_Sim_WideBus_WriteCLK;
+  Bus->DirPort = TM1629_Sim_WideBus_DirPort;
+  Bus->WritePort = TM1629_Sim_WideBus_WritePort;
+  Bus->ReadPort = TM1629_Sim_WideBus_ReadPort;
+  Bus->DelayUs = NULL;
+  Bus->DelayNs = TM1629_Sim_WideBus_DelayNs;
+
+  return (TM1629_WideBus_Init(Bus) == TM1629_OK) ? 0 : -1;
+}
+
+/**
+ * @brief  Attach a simulated TM1629 to wide bus
+ * @param  Bus: Pointer to wide bus (see TM1629_Platform_Init_Sim_WideBus)
+ * @param  Handler: Pointer to handler holding the display RAM shadow of the
+ *                  chip. It must be initialized by TM1629_Init.
+ * @param  Sim: Pointer to simulated chip
+ * @param  DIOMask: DIO pin of the chip on the port (one bit)
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: TM1629_WideBus_Attach failed.
+ */
+int8_t
+TM1629_Platform_Attach_Sim_WideBus(TM1629_WideBus_t *Bus,
+                                   TM1629_Handler_t *Handler,
+                                   TM1629_Sim_t *Sim, uint32_t DIOMask)
+{
+  TM1629_Sim_WideBus_t *Port = TM1629_SIM_WIDE_BUS(Bus->Context);
+
+  if (TM1629_WideBus_Attach(Bus, Handler, DIOMask, NULL) != TM1629_OK)
+    return -1;
+
+  Port->Chips[Port->NumOfChips] = Sim;
+  Port->DIOMask[Port->NumOfChips] = DIOMask;
+  Port->NumOfChips++;
+  return 0;
+}
+#endif
@@ -0,0 +1,345 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_platform.h
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  A simulated TM1629 as Platform dependent layer for TM1629 Driver
+ *         (host side, Linux)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Define to prevent recursive inclusion ----------------------------------------*/
+#ifndef _TM1629_PLATFORM_H_
+#define _TM1629_PLATFORM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629.h"
+#include <stdint.h>
+
+
+#if (TM1629_CONFIG_SUPPORT_GPIO == 0)
+  #error "TM1629: Simulator needs GPIO support!"
+#endif
+
+
+
+/* Exported Constants -----------------------------------------------------------*/
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM || TM1629_CONFIG_SUPPORT_MMIO)
+/**
+ * @brief  Pins of the simulated GPIO port (waveforms and MMIO registers)
+ */
+#define TM1629_SIM_PORT_STB_MASK          0x01
+#define TM1629_SIM_PORT_CLK_MASK          0x02
+#define TM1629_SIM_PORT_DIO_MASK          0x04
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+/**
+ * @brief  Most simulated chips accessed through MMIO registers at once
+ */
+#define TM1629_SIM_MMIO_MAX_CHIPS         8
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+/**
+ * @brief  Time each port word of a waveform stays on the simulated port
+ */
+#define TM1629_SIM_WAVEFORM_TICK_NS       250
+#endif
+
+
+
+/* Exported Data Types ----------------------------------------------------------*/
+/**
+ * @brief  State of one simulated TM1629 (used as context of platform functions)
+ * @note   The chip decodes STB/CLK/DIO edges exactly like the real one: bits
+ *         are sampled on rising edges of CLK (LSB first), key data is shifted
+ *         out on falling edges of CLK and STB frames each command.
+ * @note   Time only advances through the delay functions of the driver and
+ *         played waveforms.
+ */
+typedef struct TM1629_Sim_s
+{
+  // Pins driven by the driver
+  uint8_t STB;
+  uint8_t CLK;
+  uint8_t DIO;
+  // DIO direction on the driver side (0: Input, 1: Output)
+  uint8_t DirDIO;
+
+  // Display RAM
+  uint8_t DisplayRAM[16];
+  // Last data setting command
+  uint8_t DataCommand;
+  // Last display control command (0: Not received yet)
+  uint8_t DisplayControl;
+  // Address pointer
+  uint8_t Address;
+  // Key matrix served to key scan reads (see TM1629_Sim_SetKeys)
+  uint8_t KeyRegs[4];
+
+  // Shift register state of the current transaction
+  uint8_t Shift;
+  uint8_t NumOfBits;
+  uint8_t NumOfBytes;
+  uint8_t Reading;
+  uint8_t ReadBit;
+  uint8_t OutBit;
+
+  // Virtual time (ns)
+  uint64_t TimeNs;
+
+  // Edge counters (level changes of each pin)
+  uint32_t EdgesSTB;
+  uint32_t EdgesCLK;
+  uint32_t EdgesDIO;
+  // Calls of WriteSTB, WriteCLK and WriteDIO (level changed or not)
+  uint32_t PinWrites;
+  // Calls of DirDIO
+  uint32_t DirChanges;
+  // Calls of all platform functions
+  uint32_t Calls;
+  // Completed transactions (STB low to high)
+  uint32_t Transactions;
+  // Bytes received and sent by the chip
+  uint32_t BytesWritten;
+  uint32_t BytesRead;
+  // Protocol errors (partial bytes, data sampled from an undriven DIO, DIO
+  // driven by both sides)
+  uint32_t Errors;
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+  // Registers of the simulated GPIO port (see TM1629_Sim_MMIOStore)
+  uint32_t PortSet;
+  uint32_t PortClear;
+  uint32_t PortInput;
+  // Stores to the set and clear registers
+  uint32_t RegisterWrites;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+  // Format of played port words (TM1629_WaveformFormat_t)
+  uint8_t WaveformFormat;
+  // Played waveforms and port words
+  uint32_t Waveforms;
+  uint32_t WaveformWords;
+#endif
+} TM1629_Sim_t;
+
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Simulated GPIO port of a wide bus (used as context of the bus)
+ * @note   STB, CLK and delays are fanned out to all chips, DIO pins of the
+ *         port are routed to the chip owning them.
+ */
+typedef struct TM1629_Sim_WideBus_s
+{
+  // Simulated chips and their DIO pin on the port
+  TM1629_Sim_t *Chips[TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS];
+  uint32_t DIOMask[TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS];
+  uint8_t NumOfChips;
+  // CLK pin on the port (0: CLK is written by WriteCLK of the bus)
+  uint32_t CLKMask;
+} TM1629_Sim_WideBus_t;
+#endif
+
+
+
+/**
+ ==================================================================================
+                               ##### Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Reset simulated chip (display RAM, commands and statistics)
+ * @param  Sim: Pointer to simulated chip
+ * @retval None
+ */
+void
+TM1629_Sim_Reset(TM1629_Sim_t *Sim);
+
+
+/**
+ * @brief  Reset virtual time and statistics of simulated chip
+ * @param  Sim: Pointer to simulated chip
+ * @retval None
+ */
+void
+TM1629_Sim_ResetStats(TM1629_Sim_t *Sim);
+
+
+/**
+ * @brief  Set pressed keys of simulated chip
+ * @param  Sim: Pointer to simulated chip
+ * @param  Keys: Pressed keys in the format returned by TM1629_ScanKeys
+ * @retval None
+ */
+void
+TM1629_Sim_SetKeys(TM1629_Sim_t *Sim, uint32_t Keys);
+
+
+/**
+ * @brief  Get brightness level of simulated chip
+ * @param  Sim: Pointer to simulated chip
+ * @retval Brightness level (0 to 7), -1 if the display is OFF
+ */
+int8_t
+TM1629_Sim_GetBrightness(const TM1629_Sim_t *Sim);
+
+
+/**
+ * @brief  Pin and delay functions of simulated chip (linked by
+ *         TM1629_Platform_Init_Sim, or bound at compile time by
+ *         TM1629_platform_static.h)
+ * @param  Context: Pointer to simulated chip
+ * @retval Same as the platform function types of the driver
+ */
+int8_t TM1629_Sim_DirDIO(void *Context, uint8_t Dir);
+int8_t TM1629_Sim_WriteDIO(void *Context, uint8_t State);
+int8_t TM1629_Sim_ReadDIO(void *Context);
+int8_t TM1629_Sim_WriteSTB(void *Context, uint8_t State);
+int8_t TM1629_Sim_WriteCLK(void *Context, uint8_t State);
+int8_t TM1629_Sim_DelayNs(void *Context, uint16_t Delay);
+
+
+/**
+ * @brief  Initialize platform device to communicate a simulated TM1629
+ * @param  Handler: Pointer to handler
+ * @param  Sim: Pointer to simulated chip. It must stay valid while the handler
+ *              is used.
+ * @retval None
+ */
+void
+TM1629_Platform_Init_Sim(TM1629_Handler_t *Handler, TM1629_Sim_t *Sim);
+
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+/**
+ * @brief  Let the driver access a simulated TM1629 through the registers of a
+ *         simulated GPIO port (call after TM1629_Platform_Init_Sim)
+ * @param  Handler: Pointer to handler
+ * @param  Sim: Pointer to simulated chip
+ * @note   The registers are plain RAM. Register accesses of the driver only
+ *         reach the chip when TM1629_config.h routes them to the hooks:
+ *         @code
+ *         void TM1629_Sim_MMIOStore(volatile uint32_t *Reg, uint32_t Value);
+ *         uint32_t TM1629_Sim_MMIOLoad(volatile const uint32_t *Reg);
+ *         #define TM1629_CONFIG_MMIO_STORE(REG, VALUE)  TM1629_Sim_MMIOStore(REG, VALUE)
+ *         #define TM1629_CONFIG_MMIO_LOAD(REG)          TM1629_Sim_MMIOLoad(REG)
+ *         @endcode
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: Too many simulated chips ('TM1629_SIM_MMIO_MAX_CHIPS').
+ */
+int8_t
+TM1629_Platform_Init_Sim_MMIO(TM1629_Handler_t *Handler, TM1629_Sim_t *Sim);
+
+
+/**
+ * @brief  Store to a register (hook of TM1629_CONFIG_MMIO_STORE)
+ * @param  Reg: Pointer to register. Set and clear registers of simulated
+ *              chips drive their pins, other registers are written as is.
+ * @param  Value: Value to store
+ * @retval None
+ */
+void
+TM1629_Sim_MMIOStore(volatile uint32_t *Reg, uint32_t Value);
+
+
+/**
+ * @brief  Load from a register (hook of TM1629_CONFIG_MMIO_LOAD)
+ * @param  Reg: Pointer to register. Input registers of simulated chips return
+ *              the DIO level, other registers are read as is.
+ * @retval Value of the register
+ */
+uint32_t
+TM1629_Sim_MMIOLoad(volatile const uint32_t *Reg);
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+/**
+ * @brief  Let the driver send write transactions to a simulated TM1629 as
+ *         compiled waveforms (call after TM1629_Platform_Init_Sim)
+ * @param  Handler: Pointer to handler
+ * @param  Sim: Pointer to simulated chip
+ * @param  Buffer: Buffer of compiled waveform
+ * @param  Size: Size of the buffer in words
+ * @param  Format: Format of port words (TM1629_WaveformFormat_t)
+ * @retval None
+ */
+void
+TM1629_Platform_Init_Sim_Waveform(TM1629_Handler_t *Handler, TM1629_Sim_t *Sim,
+                                  uint32_t *Buffer, uint16_t Size,
+                                  TM1629_WaveformFormat_t Format);
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Initialize wide bus on a simulated GPIO port
+ * @param  Bus: Pointer to wide bus
+ * @param  Port: Pointer to simulated port. It must stay valid while the bus is
+ *               used.
+ * @param  CLKMask: CLK pin on the port (0: CLK is written by WriteCLK)
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: TM1629_WideBus_Init failed.
+ */
+int8_t
+TM1629_Platform_Init_Sim_WideBus(TM1629_WideBus_t *Bus,
+                                 TM1629_Sim_WideBus_t *Port, uint32_t CLKMask);
+
+
+/**
+ * @brief  Attach a simulated TM1629 to wide bus
+ * @param  Bus: Pointer to wide bus (see TM1629_Platform_Init_Sim_WideBus)
+ * @param  Handler: Pointer to handler holding the display RAM shadow of the
+ *                  chip. It must be initialized by TM1629_Init.
+ * @param  Sim: Pointer to simulated chip
+ * @param  DIOMask: DIO pin of the chip on the port (one bit)
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: TM1629_WideBus_Attach failed.
+ */
+int8_t
+TM1629_Platform_Attach_Sim_WideBus(TM1629_WideBus_t *Bus,
+                                   TM1629_Handler_t *Handler,
+                                   TM1629_Sim_t *Sim, uint32_t DIOMask);
+#endif
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //! _TM1629_PLATFORM_H_
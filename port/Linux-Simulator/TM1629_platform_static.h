@@ -0,0 +1,63 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_platform_static.h
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Compile-time bound GPIO functions of the simulated TM1629
+ *         (TM1629_CONFIG_STATIC_PLATFORM, host side, Linux)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Define to prevent recursive inclusion ----------------------------------------*/
+#ifndef _TM1629_PLATFORM_STATIC_H_
+#define _TM1629_PLATFORM_STATIC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629_platform.h"
+
+
+
+/* Bound Functions --------------------------------------------------------------*/
+/**
+ * @brief  'CONTEXT' is the simulated chip set by TM1629_Platform_Init_Sim
+ */
+#define TM1629_PORT_WRITE_STB(CONTEXT, STATE)  TM1629_Sim_WriteSTB(CONTEXT, STATE)
+#define TM1629_PORT_WRITE_CLK(CONTEXT, STATE)  TM1629_Sim_WriteCLK(CONTEXT, STATE)
+#define TM1629_PORT_WRITE_DIO(CONTEXT, STATE)  TM1629_Sim_WriteDIO(CONTEXT, STATE)
+#define TM1629_PORT_READ_DIO(CONTEXT)          TM1629_Sim_ReadDIO(CONTEXT)
+#define TM1629_PORT_DIR_DIO(CONTEXT, DIR)      TM1629_Sim_DirDIO(CONTEXT, DIR)
+#define TM1629_PORT_DELAY_NS(CONTEXT, DELAY)   TM1629_Sim_DelayNs(CONTEXT, DELAY)
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //! _TM1629_PLATFORM_STATIC_H_
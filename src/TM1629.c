@@ -33,6 +33,10 @@
 
 /* Includes ---------------------------------------------------------------------*/
 #include "TM1629.h"
+#include <string.h>
+#if (TM1629_CONFIG_STATIC_PLATFORM)
+#include TM1629_CONFIG_STATIC_PLATFORM_HEADER
+#endif
 
 
 /* Private Constants ------------------------------------------------------------*/
@@ -42,6 +46,7 @@
 #define COMMAND_DATA_READING_WRITING_SETTING    0x40  // 0b01000000
 #define COMMAND_DISPLAY_CONTROL                 0x80  // 0b10000000
 #define COMMAND_ADDRESS_SETTING                 0xC0  // 0b11000000
+#define COMMAND_MASK                            0xC0  // 0b11000000
 
 /**
  * @brief  Data reading/writing setting command
@@ -59,28 +64,150 @@
 #define COMMAND_DC_DISPLAY_IS_OFF   0x00  // 0b00000000
 #define COMMAND_DC_DISPLAY_IS_ON    0x08  // 0b00001000
 
+/**
+ * @brief  DIO direction
+ */
+#define DIR_DIO_INPUT     0
+#define DIR_DIO_OUTPUT    1
+#define DIR_DIO_UNKNOWN   0xFF
+
+/**
+ * @brief  Delay calibration
+ */
+#define CALIBRATION_MIN_TIME_NS   50000   // Shortest measured interval
+#define CALIBRATION_MAX_COUNT     4096    // Most calls or loops in one interval
+#define CALIBRATION_RUNS          4       // Measurements of each cost
+#define CALIBRATION_USE_DELAY     0xFFFF  // Loop count using the delay function
+
 
 /* Private Macros ---------------------------------------------------------------*/
-#define TM1629_CHECK_PLATFORM_INIT(HANDLER)       ((HANDLER)->Platform.Init)
-#define TM1629_CHECK_PLATFORM_DEINIT(HANDLER)     ((HANDLER)->Platform.DeInit)
-#define TM1629_CHECK_PLATFORM_WRITE_STB(HANDLER)  ((HANDLER)->Platform.WriteSTB)
-#define TM1629_CHECK_PLATFORM_DIR_DIO(HANDLER)    ((HANDLER)->Platform.GPIO.DirDIO)
-#define TM1629_CHECK_PLATFORM_WRITE_DIO(HANDLER)  ((HANDLER)->Platform.GPIO.WriteDIO)
-#define TM1629_CHECK_PLATFORM_WRITE_CLK(HANDLER)  ((HANDLER)->Platform.GPIO.WriteCLK)
-#define TM1629_CHECK_PLATFORM_READ_DIO(HANDLER)   ((HANDLER)->Platform.GPIO.ReadDIO)
-#define TM1629_CHECK_PLATFORM_DELAY_US(HANDLER)   ((HANDLER)->Platform.GPIO.DelayUs)
-
-#define TM1629_PLATFORM_INIT(HANDLER)     (HANDLER)->Platform.Init()
-#define TM1629_PLATFORM_DEINIT(HANDLER)   (HANDLER)->Platform.DeInit()
-#define TM1629_WRITE_STB(HANDLER, STATE)  (HANDLER)->Platform.WriteSTB(STATE)
-#define TM1629_DIR_DIO(HANDLER, DIR)      (HANDLER)->Platform.GPIO.DirDIO(DIR)
-#define TM1629_WRITE_DIO(HANDLER, STATE)  (HANDLER)->Platform.GPIO.WriteDIO(STATE)
-#define TM1629_WRITE_CLK(HANDLER, STATE)  (HANDLER)->Platform.GPIO.WriteCLK(STATE)
-#define TM1629_READ_DIO(HANDLER)          (HANDLER)->Platform.GPIO.ReadDIO()
-#define TM1629_DELAY_US(HANDLER, DELAY)   (HANDLER)->Platform.GPIO.DelayUs(DELAY)
+#define TM1629_OPS(HANDLER)               TM1629_PLATFORM_OPS(&(HANDLER)->Platform)
+
+#define TM1629_CHECK_PLATFORM_INIT(HANDLER)       (TM1629_OPS(HANDLER)->Init)
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+#define TM1629_CHECK_PLATFORM_DEINIT(HANDLER) \
+  ((HANDLER)->Platform.Ops && TM1629_OPS(HANDLER)->DeInit)
+#else
+#define TM1629_CHECK_PLATFORM_DEINIT(HANDLER)     (TM1629_OPS(HANDLER)->DeInit)
+#endif
+#if (TM1629_CONFIG_STATIC_PLATFORM)
+// Bound at compile time by the port
+#define TM1629_CHECK_PLATFORM_WRITE_STB(HANDLER)  1
+#define TM1629_CHECK_PLATFORM_DIR_DIO(HANDLER)    1
+#define TM1629_CHECK_PLATFORM_WRITE_DIO(HANDLER)  1
+#define TM1629_CHECK_PLATFORM_WRITE_CLK(HANDLER)  1
+#define TM1629_CHECK_PLATFORM_READ_DIO(HANDLER)   1
+#define TM1629_CHECK_PLATFORM_DELAY_US(HANDLER)   1
+#define TM1629_CHECK_PLATFORM_DELAY_NS(HANDLER)   1
+#else
+#define TM1629_CHECK_PLATFORM_WRITE_STB(HANDLER)  (TM1629_OPS(HANDLER)->WriteSTB)
+#define TM1629_CHECK_PLATFORM_DIR_DIO(HANDLER)    (TM1629_OPS(HANDLER)->GPIO.DirDIO)
+#define TM1629_CHECK_PLATFORM_WRITE_DIO(HANDLER)  (TM1629_OPS(HANDLER)->GPIO.WriteDIO)
+#define TM1629_CHECK_PLATFORM_WRITE_CLK(HANDLER)  (TM1629_OPS(HANDLER)->GPIO.WriteCLK)
+#define TM1629_CHECK_PLATFORM_READ_DIO(HANDLER)   (TM1629_OPS(HANDLER)->GPIO.ReadDIO)
+#define TM1629_CHECK_PLATFORM_DELAY_US(HANDLER)   (TM1629_OPS(HANDLER)->GPIO.DelayUs)
+#define TM1629_CHECK_PLATFORM_DELAY_NS(HANDLER)   (TM1629_OPS(HANDLER)->GPIO.DelayNs)
+#endif
+#define TM1629_CHECK_PLATFORM_WRITE_BUFFER(HANDLER) (TM1629_OPS(HANDLER)->GPIO.WriteBuffer)
+#define TM1629_CHECK_PLATFORM_READ_BUFFER(HANDLER)  (TM1629_OPS(HANDLER)->GPIO.ReadBuffer)
+#define TM1629_CHECK_PLATFORM_SPI_WRITE(HANDLER)  (TM1629_OPS(HANDLER)->SPI.Write)
+#define TM1629_CHECK_PLATFORM_SPI_READ(HANDLER)   (TM1629_OPS(HANDLER)->SPI.Read)
+#define TM1629_CHECK_PLATFORM_GET_TIME_US(HANDLER) (TM1629_OPS(HANDLER)->GetTimeUs)
+#define TM1629_CHECK_PLATFORM_GET_TIME_NS(HANDLER) (TM1629_OPS(HANDLER)->GPIO.GetTimeNs)
+#define TM1629_CHECK_PLATFORM_PLAY_WAVEFORM(HANDLER) (TM1629_OPS(HANDLER)->GPIO.Waveform.Play)
+#define TM1629_CHECK_PLATFORM_MMIO(HANDLER) \
+  (TM1629_IS_COMMUNICATION_GPIO(HANDLER) && (HANDLER)->Platform.GPIO.MMIO.Set)
+#define TM1629_CHECK_PLATFORM_TIMER(HANDLER) \
+  (TM1629_OPS(HANDLER)->GPIO.TimerStart && TM1629_OPS(HANDLER)->GPIO.TimerStop)
+
+#define TM1629_PLATFORM_INIT(HANDLER)     TM1629_OPS(HANDLER)->Init((HANDLER)->Platform.Context)
+#define TM1629_PLATFORM_DEINIT(HANDLER)   TM1629_OPS(HANDLER)->DeInit((HANDLER)->Platform.Context)
+#if (TM1629_CONFIG_STATIC_PLATFORM)
+// Pin and delay functions of the port are inlined in the bit loops
+#define TM1629_WRITE_STB(HANDLER, STATE)  TM1629_PORT_WRITE_STB((HANDLER)->Platform.Context, STATE)
+#define TM1629_DIR_DIO(HANDLER, DIR)      TM1629_PORT_DIR_DIO((HANDLER)->Platform.Context, DIR)
+#define TM1629_WRITE_DIO(HANDLER, STATE)  TM1629_PORT_WRITE_DIO((HANDLER)->Platform.Context, STATE)
+#define TM1629_WRITE_CLK(HANDLER, STATE)  TM1629_PORT_WRITE_CLK((HANDLER)->Platform.Context, STATE)
+#define TM1629_READ_DIO(HANDLER)          TM1629_PORT_READ_DIO((HANDLER)->Platform.Context)
+#define TM1629_DELAY_US(HANDLER, DELAY)   TM1629_PORT_DELAY_NS((HANDLER)->Platform.Context, (uint16_t)(DELAY) * 1000)
+#define TM1629_DELAY_NS(HANDLER, DELAY)   TM1629_PORT_DELAY_NS((HANDLER)->Platform.Context, DELAY)
+#else
+#define TM1629_DIR_DIO(HANDLER, DIR)      TM1629_OPS(HANDLER)->GPIO.DirDIO((HANDLER)->Platform.Context, DIR)
+#define TM1629_DELAY_US(HANDLER, DELAY)   TM1629_OPS(HANDLER)->GPIO.DelayUs((HANDLER)->Platform.Context, DELAY)
+#define TM1629_DELAY_NS(HANDLER, DELAY)   TM1629_OPS(HANDLER)->GPIO.DelayNs((HANDLER)->Platform.Context, DELAY)
+#endif
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+// Pins of handlers with MMIO registers are written without calls
+#define TM1629_WRITE_STB(HANDLER, STATE)  TM1629_MMIO_WriteSTB(HANDLER, STATE)
+#define TM1629_WRITE_DIO(HANDLER, STATE)  TM1629_MMIO_WriteDIO(HANDLER, STATE)
+#define TM1629_WRITE_CLK(HANDLER, STATE)  TM1629_MMIO_WriteCLK(HANDLER, STATE)
+#define TM1629_READ_DIO(HANDLER)          TM1629_MMIO_ReadDIO(HANDLER)
+#elif (!TM1629_CONFIG_STATIC_PLATFORM)
+#define TM1629_WRITE_STB(HANDLER, STATE)  TM1629_OPS(HANDLER)->WriteSTB((HANDLER)->Platform.Context, STATE)
+#define TM1629_WRITE_DIO(HANDLER, STATE)  TM1629_OPS(HANDLER)->GPIO.WriteDIO((HANDLER)->Platform.Context, STATE)
+#define TM1629_WRITE_CLK(HANDLER, STATE)  TM1629_OPS(HANDLER)->GPIO.WriteCLK((HANDLER)->Platform.Context, STATE)
+#define TM1629_READ_DIO(HANDLER)          TM1629_OPS(HANDLER)->GPIO.ReadDIO((HANDLER)->Platform.Context)
+#endif
+#define TM1629_WRITE_BUFFER(HANDLER, DATA, LEN) \
+  TM1629_OPS(HANDLER)->GPIO.WriteBuffer((HANDLER)->Platform.Context, DATA, LEN)
+#define TM1629_READ_BUFFER(HANDLER, DATA, LEN) \
+  TM1629_OPS(HANDLER)->GPIO.ReadBuffer((HANDLER)->Platform.Context, DATA, LEN)
+#define TM1629_SPI_WRITE(HANDLER, DATA, LEN) \
+  TM1629_OPS(HANDLER)->SPI.Write((HANDLER)->Platform.Context, DATA, LEN)
+#define TM1629_SPI_READ(HANDLER, DATA, LEN) \
+  TM1629_OPS(HANDLER)->SPI.Read((HANDLER)->Platform.Context, DATA, LEN)
+#define TM1629_GET_TIME_US(HANDLER)       TM1629_OPS(HANDLER)->GetTimeUs((HANDLER)->Platform.Context)
+#define TM1629_GET_TIME_NS(HANDLER)       TM1629_OPS(HANDLER)->GPIO.GetTimeNs((HANDLER)->Platform.Context)
+#define TM1629_TIMER_START(HANDLER, PERIOD) \
+  TM1629_OPS(HANDLER)->GPIO.TimerStart((HANDLER)->Platform.Context, PERIOD)
+#define TM1629_TIMER_STOP(HANDLER)        TM1629_OPS(HANDLER)->GPIO.TimerStop((HANDLER)->Platform.Context)
+#define TM1629_PLAY_WAVEFORM(HANDLER, WORDS, LEN) \
+  TM1629_OPS(HANDLER)->GPIO.Waveform.Play((HANDLER)->Platform.Context, WORDS, LEN)
 
 #define TM1629_CHECK_RES_PLATFORM(FUNC)        (FUNC >= 0)
 
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+#define TM1629_MMIO_PIN(REGS, MASK, STATE) \
+  TM1629_CONFIG_MMIO_STORE((STATE) ? (REGS)->Set : (REGS)->Clear, MASK)
+
+#define TM1629_CHECK_PLATFORM_PINS(HANDLER)                                  \
+  (TM1629_CHECK_PLATFORM_MMIO(HANDLER) ?                                      \
+   ((HANDLER)->Platform.GPIO.MMIO.Clear && (HANDLER)->Platform.GPIO.MMIO.Input && \
+    ((HANDLER)->Platform.GPIO.MMIO.STBMask || TM1629_CHECK_PLATFORM_WRITE_STB(HANDLER))) : \
+   (TM1629_CHECK_PLATFORM_WRITE_STB(HANDLER) &&                               \
+    TM1629_CHECK_PLATFORM_WRITE_DIO(HANDLER) &&                               \
+    TM1629_CHECK_PLATFORM_WRITE_CLK(HANDLER) &&                               \
+    TM1629_CHECK_PLATFORM_READ_DIO(HANDLER)))
+#else
+#define TM1629_CHECK_PLATFORM_PINS(HANDLER)    \
+  (TM1629_CHECK_PLATFORM_WRITE_STB(HANDLER) && \
+   TM1629_CHECK_PLATFORM_WRITE_DIO(HANDLER) && \
+   TM1629_CHECK_PLATFORM_WRITE_CLK(HANDLER) && \
+   TM1629_CHECK_PLATFORM_READ_DIO(HANDLER))
+#endif
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+#define TM1629_STATS_ADD(HANDLER, FIELD, N)    (HANDLER)->Stats.FIELD += (N)
+#else
+#define TM1629_STATS_ADD(HANDLER, FIELD, N)    do {} while (0)
+#endif
+
+#if (TM1629_CONFIG_ENABLE_TRACE)
+#define TM1629_TRACE(HANDLER, HOOK, KIND, CMD, LEN) \
+  do { if ((HANDLER)->HOOK) (HANDLER)->HOOK(HANDLER, KIND, CMD, LEN); } while (0)
+#else
+#define TM1629_TRACE(HANDLER, HOOK, KIND, CMD, LEN) \
+  do { (void)(KIND); (void)(CMD); (void)(LEN); } while (0)
+#endif
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+#define TM1629_DELAY_TIMING(HANDLER, FIELD) \
+  TM1629_DelayLoops(HANDLER, (HANDLER)->Timing.FIELD, (HANDLER)->Calibration.Loops.FIELD)
+#else
+#define TM1629_DELAY_TIMING(HANDLER, FIELD) \
+  TM1629_Delay(HANDLER, (HANDLER)->Timing.FIELD)
+#endif
+
 #if (TM1629_CONFIG_SUPPORT_SPI && TM1629_CONFIG_SUPPORT_GPIO)
 #define TM1629_IS_COMMUNICATION_GPIO(HANDLER)  ((HANDLER)->Platform.Communication == TM1629_COMMUNICATION_GPIO)
 #define TM1629_IS_COMMUNICATION_SPI(HANDLER)   ((HANDLER)->Platform.Communication == TM1629_COMMUNICATION_SPI)
@@ -94,51 +221,53 @@
 
 
 /* Private variables ------------------------------------------------------------*/
+/**
+ * @brief  Seven-Segment code of supported characters
+ */
+#define TM1629_CHAR_GLYPHS(X) \
+  X('0', 0x3F) X('1', 0x06) X('2', 0x5B) X('3', 0x4F) X('4', 0x66)  \
+  X('5', 0x6D) X('6', 0x7D) X('7', 0x07) X('8', 0x7F) X('9', 0x6F)  \
+  X('A', 0x77) X('a', 0x77) X('B', 0x7C) X('b', 0x7C) X('C', 0x39)  \
+  X('c', 0x39) X('D', 0x5E) X('d', 0x5E) X('E', 0x79) X('e', 0x79)  \
+  X('F', 0x71) X('f', 0x71) X('g', 0x6F) X('G', 0x3D) X('h', 0x74)  \
+  X('H', 0x76) X('i', 0x05) X('I', 0x06) X('j', 0x0D) X('J', 0x0D)  \
+  X('l', 0x30) X('L', 0x38) X('n', 0x54) X('N', 0x37) X('o', 0x5C)  \
+  X('O', 0x3F) X('p', 0x73) X('P', 0x73) X('q', 0x67) X('Q', 0x67)  \
+  X('r', 0x50) X('R', 0x50) X('s', 0x6D) X('S', 0x6D) X('t', 0x78)  \
+  X('T', 0x78) X('u', 0x1C) X('U', 0x3E) X('y', 0x66) X('Y', 0x66)  \
+  X('_', 0x08) X('-', 0x40) X('~', 0x01) X('.', TM1629_DECIMAL_POINT)
+
+/**
+ * @brief  Seven-Segment code of supported hexadecimal digits
+ */
+#define TM1629_HEX_GLYPHS(X) \
+  X(0x00, 0x3F) X(0x01, 0x06) X(0x02, 0x5B) X(0x03, 0x4F) X(0x04, 0x66)  \
+  X(0x05, 0x6D) X(0x06, 0x7D) X(0x07, 0x07) X(0x08, 0x7F) X(0x09, 0x6F)  \
+  X(0x0A, 0x77) X(0x0B, 0x7C) X(0x0C, 0x39) X(0x0D, 0x5E) X(0x0E, 0x79)  \
+  X(0x0F, 0x71) X('A', 0x77)  X('a', 0x77)  X('B', 0x7C)  X('b', 0x7C)   \
+  X('C', 0x39)  X('c', 0x39)  X('D', 0x5E)  X('d', 0x5E)  X('E', 0x79)   \
+  X('e', 0x79)  X('F', 0x71)  X('f', 0x71)
+
+/**
+ * @brief  Each glyph is placed twice, the second one with decimal point set
+ */
+#define TM1629_GLYPH_ENTRY(CODE, SEG) \
+  [(CODE)] = (SEG), [(CODE) | TM1629_DECIMAL_POINT] = (SEG) | TM1629_DECIMAL_POINT,
+
+/**
+ * @brief  Convert character to Seven-Segment code ('.' sets decimal point)
+ */
+static const uint8_t CharTo7Seg[256] =
+{
+  TM1629_CHAR_GLYPHS(TM1629_GLYPH_ENTRY)
+};
+
 /**
  * @brief  Convert HEX number to Seven-Segment code
  */
-const uint8_t HexTo7Seg[40] =
-{
-  0x3F, // 0
-  0x06, // 1
-  0x5B, // 2
-  0x4F, // 3
-  0x66, // 4
-  0x6D, // 5
-  0x7D, // 6
-  0x07, // 7
-  0x7F, // 8
-  0x6F, // 9
-  0x77, // A
-  0x7c, // b
-  0x39, // C
-  0x5E, // d
-  0x79, // E
-  0x71, // F
-  0x6F, // g
-  0x3D, // G
-  0x74, // h
-  0x76, // H
-  0x05, // i
-  0x06, // I
-  0x0D, // j
-  0x30, // l
-  0x38, // L
-  0x54, // n
-  0x37, // N
-  0x5C, // o
-  0x3F, // O
-  0x73, // P
-  0x67, // q
-  0x50, // r
-  0x6D, // S
-  0x78, // t
-  0x1C, // u
-  0x3E, // U
-  0x66, // y
-  0x08, // _
-  0x40, // -
-  0x01  // Overscore
+static const uint8_t HexTo7Seg[256] =
+{
+  TM1629_HEX_GLYPHS(TM1629_GLYPH_ENTRY)
 };
 
 
@@ -149,37 +278,308 @@ const uint8_t HexTo7Seg[40] =
  ==================================================================================
  */
 
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+static inline int8_t
+TM1629_MMIO_WriteSTB(TM1629_Handler_t *Handler, uint8_t State)
+{
+  if (TM1629_CHECK_PLATFORM_MMIO(Handler) && Handler->Platform.GPIO.MMIO.STBMask)
+  {
+    TM1629_MMIO_PIN(&Handler->Platform.GPIO.MMIO,
+                    Handler->Platform.GPIO.MMIO.STBMask, State);
+    return 0;
+  }
+
+  return TM1629_OPS(Handler)->WriteSTB(Handler->Platform.Context, State);
+}
+
+static inline int8_t
+TM1629_MMIO_WriteDIO(TM1629_Handler_t *Handler, uint8_t State)
+{
+  if (!TM1629_CHECK_PLATFORM_MMIO(Handler))
+    return TM1629_OPS(Handler)->GPIO.WriteDIO(Handler->Platform.Context, State);
+
+  TM1629_MMIO_PIN(&Handler->Platform.GPIO.MMIO,
+                  Handler->Platform.GPIO.MMIO.DIOMask, State);
+  return 0;
+}
+
+static inline int8_t
+TM1629_MMIO_WriteCLK(TM1629_Handler_t *Handler, uint8_t State)
+{
+  if (!TM1629_CHECK_PLATFORM_MMIO(Handler))
+    return TM1629_OPS(Handler)->GPIO.WriteCLK(Handler->Platform.Context, State);
+
+  TM1629_MMIO_PIN(&Handler->Platform.GPIO.MMIO,
+                  Handler->Platform.GPIO.MMIO.CLKMask, State);
+  return 0;
+}
+
+static inline int8_t
+TM1629_MMIO_ReadDIO(TM1629_Handler_t *Handler)
+{
+  if (!TM1629_CHECK_PLATFORM_MMIO(Handler))
+    return TM1629_OPS(Handler)->GPIO.ReadDIO(Handler->Platform.Context);
+
+  return (TM1629_CONFIG_MMIO_LOAD(Handler->Platform.GPIO.MMIO.Input) &
+          Handler->Platform.GPIO.MMIO.DIOInputMask) ? 1 : 0;
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+static inline void
+TM1629_Delay(TM1629_Handler_t *Handler, uint16_t DelayNs)
+{
+  if (!DelayNs)
+    return;
+
+  if (TM1629_CHECK_PLATFORM_DELAY_NS(Handler))
+    TM1629_DELAY_NS(Handler, DelayNs);
+  else
+    TM1629_DELAY_US(Handler, (DelayNs + 999) / 1000);
+}
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+static void
+TM1629_SpinLoops(uint16_t Loops)
+{
+  volatile uint16_t Counter = Loops;
+
+  while (Counter)
+    Counter--;
+}
+
+static inline void
+TM1629_DelayLoops(TM1629_Handler_t *Handler, uint16_t DelayNs, uint16_t Loops)
+{
+  if (!Handler->Calibration.Valid || Loops == CALIBRATION_USE_DELAY)
+    TM1629_Delay(Handler, DelayNs);
+  else if (Loops)
+    TM1629_SpinLoops(Loops);
+}
+
+/**
+ * @brief  Measure the cost of pin write calls or of busy-wait loops
+ * @param  Spin: 0: Pin write calls, 1: Busy-wait loops
+ * @retval Cost of one call or loop in 1/16 ns (rounded down)
+ */
+static uint32_t
+TM1629_CalibrationMeasure(TM1629_Handler_t *Handler, uint8_t Spin)
+{
+  uint32_t Elapsed = 0;
+  uint16_t Count = 0;
+
+  for (Count = 16; ; Count *= 2)
+  {
+    Elapsed = TM1629_GET_TIME_NS(Handler);
+    if (Spin)
+      TM1629_SpinLoops(Count);
+    else
+      for (uint16_t i = 0; i < Count; i++)
+        TM1629_WRITE_CLK(Handler, 1); // CLK is already high when idle
+    Elapsed = TM1629_GET_TIME_NS(Handler) - Elapsed;
+
+    if (Elapsed >= CALIBRATION_MIN_TIME_NS || Count >= CALIBRATION_MAX_COUNT)
+      break;
+  }
+
+  // Count is a multiple of 16
+  return Elapsed / (Count / 16);
+}
+
+static uint16_t
+TM1629_CalibrateDelay(TM1629_Handler_t *Handler, uint16_t DelayNs)
+{
+  uint32_t Loops = 0;
+
+  // The pin write call ending the delay already takes part of it
+  if (DelayNs <= Handler->Calibration.PinWriteNs)
+    return 0;
+
+  DelayNs -= Handler->Calibration.PinWriteNs;
+  Loops = ((uint32_t)DelayNs * 16 + Handler->Calibration.LoopCost - 1) /
+          Handler->Calibration.LoopCost;
+
+  return (Loops >= CALIBRATION_USE_DELAY) ? CALIBRATION_USE_DELAY : (uint16_t)Loops;
+}
+
+static void
+TM1629_CalibrateLoops(TM1629_Handler_t *Handler)
+{
+  TM1629_Timing_t *Loops = &Handler->Calibration.Loops;
+
+  Loops->ClockHighNs = TM1629_CalibrateDelay(Handler, Handler->Timing.ClockHighNs);
+  Loops->ClockLowNs = TM1629_CalibrateDelay(Handler, Handler->Timing.ClockLowNs);
+  Loops->TurnaroundNs = TM1629_CalibrateDelay(Handler, Handler->Timing.TurnaroundNs);
+  Loops->ByteGapNs = TM1629_CalibrateDelay(Handler, Handler->Timing.ByteGapNs);
+  Loops->StrobeNs = TM1629_CalibrateDelay(Handler, Handler->Timing.StrobeNs);
+}
+#endif
+#endif
+
 static inline void
-TM1629_StartComunication(TM1629_Handler_t *Handler)
+TM1629_StartComunication(TM1629_Handler_t *Handler, TM1629_TraceKind_t Kind,
+                         uint8_t Command, uint8_t Length)
 {
+  TM1629_TRACE(Handler, TraceBegin, Kind, Command, Length);
+  TM1629_STATS_ADD(Handler, Transactions, 1);
+#if (TM1629_CONFIG_ENABLE_STATS)
+  if (TM1629_CHECK_PLATFORM_GET_TIME_US(Handler))
+    Handler->BusyStartUs = TM1629_GET_TIME_US(Handler);
+#endif
+
   TM1629_WRITE_STB(Handler, 0);
 }
 
 static inline void
-TM1629_StopComunication(TM1629_Handler_t *Handler)
+TM1629_ReleaseComunication(TM1629_Handler_t *Handler, TM1629_TraceKind_t Kind,
+                           uint8_t Command, uint8_t Length)
 {
   TM1629_WRITE_STB(Handler, 1);
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+  if (TM1629_CHECK_PLATFORM_GET_TIME_US(Handler))
+    Handler->Stats.BusyUs += TM1629_GET_TIME_US(Handler) - Handler->BusyStartUs;
+#endif
+
+  TM1629_TRACE(Handler, TraceEnd, Kind, Command, Length);
+}
+
+static inline void
+TM1629_StopComunication(TM1629_Handler_t *Handler, TM1629_TraceKind_t Kind,
+                        uint8_t Command, uint8_t Length)
+{
+  TM1629_ReleaseComunication(Handler, Kind, Command, Length);
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+  // STB pulse width before the next transaction
+  if (TM1629_IS_COMMUNICATION_GPIO(Handler))
+    TM1629_DELAY_TIMING(Handler, StrobeNs);
+#endif
 }
 
 #if (TM1629_CONFIG_SUPPORT_GPIO)
+static inline uint8_t *
+TM1629_DirDIOState(TM1629_Handler_t *Handler)
+{
+#if (TM1629_CONFIG_SUPPORT_BUS)
+  // Chips on a shared bus share the DIO pin too
+  if (Handler->Bus)
+    return &Handler->Bus->DirDIO;
+#endif
+
+  return &Handler->DirDIO;
+}
+
+static inline int8_t
+TM1629_SetDirDIO(TM1629_Handler_t *Handler, uint8_t Dir)
+{
+  uint8_t *State = TM1629_DirDIOState(Handler);
+
+  if (*State == Dir)
+  {
+    Handler->DirDIOSkipped++;
+    return 0;
+  }
+
+  if (!TM1629_CHECK_RES_PLATFORM(TM1629_DIR_DIO(Handler, Dir)))
+  {
+    *State = DIR_DIO_UNKNOWN;
+    return -1;
+  }
+
+  TM1629_STATS_ADD(Handler, DirDIOSwitches, 1);
+  *State = Dir;
+  return 0;
+}
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+static int8_t
+TM1629_WriteBytesMMIO(TM1629_Handler_t *Handler,
+                      const uint8_t *Data, uint8_t NumOfBytes)
+{
+  volatile uint32_t *Set = Handler->Platform.GPIO.MMIO.Set;
+  volatile uint32_t *Clear = Handler->Platform.GPIO.MMIO.Clear;
+  uint32_t CLK = Handler->Platform.GPIO.MMIO.CLKMask;
+  uint32_t DIO = Handler->Platform.GPIO.MMIO.DIOMask;
+  uint8_t Buff = 0;
+
+  // Same edge order as the bit loop of TM1629_WriteBytesGPIO
+  for (uint8_t j = 0; j < NumOfBytes; j++)
+  {
+    Buff = Data[j];
+    for (uint8_t i = 0; i < 8; ++i, Buff >>= 1)
+    {
+      TM1629_CONFIG_MMIO_STORE(Clear, CLK);
+      TM1629_CONFIG_MMIO_STORE((Buff & 0x01) ? Set : Clear, DIO);
+      TM1629_DELAY_TIMING(Handler, ClockLowNs);
+      TM1629_CONFIG_MMIO_STORE(Set, CLK);
+      TM1629_DELAY_TIMING(Handler, ClockHighNs);
+    }
+  }
+
+  return 0;
+}
+
+static int8_t
+TM1629_ReadBytesMMIO(TM1629_Handler_t *Handler,
+                     uint8_t *Data, uint8_t NumOfBytes)
+{
+  volatile uint32_t *Set = Handler->Platform.GPIO.MMIO.Set;
+  volatile uint32_t *Clear = Handler->Platform.GPIO.MMIO.Clear;
+  volatile const uint32_t *Input = Handler->Platform.GPIO.MMIO.Input;
+  uint32_t CLK = Handler->Platform.GPIO.MMIO.CLKMask;
+  uint32_t DIO = Handler->Platform.GPIO.MMIO.DIOInputMask;
+  uint8_t Buff = 0;
+
+  for (uint8_t j = 0; j < NumOfBytes; j++)
+  {
+    Buff = 0;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      TM1629_CONFIG_MMIO_STORE(Clear, CLK);
+      TM1629_DELAY_TIMING(Handler, ClockLowNs);
+      TM1629_CONFIG_MMIO_STORE(Set, CLK);
+      if (TM1629_CONFIG_MMIO_LOAD(Input) & DIO)
+        Buff |= (1 << i);
+      TM1629_DELAY_TIMING(Handler, ClockHighNs);
+    }
+
+    Data[j] = Buff;
+    TM1629_DELAY_TIMING(Handler, ByteGapNs);
+  }
+
+  return 0;
+}
+#endif
+
 static inline int8_t
 TM1629_WriteBytesGPIO(TM1629_Handler_t *Handler,
                       const uint8_t *Data, uint8_t NumOfBytes)
 {
   uint8_t Buff = 0;
 
-  TM1629_DIR_DIO(Handler, 1);
+  TM1629_SetDirDIO(Handler, DIR_DIO_OUTPUT);
+
+  if (TM1629_CHECK_PLATFORM_WRITE_BUFFER(Handler))
+    return TM1629_WRITE_BUFFER(Handler, Data, NumOfBytes);
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+  if (TM1629_CHECK_PLATFORM_MMIO(Handler))
+    return TM1629_WriteBytesMMIO(Handler, Data, NumOfBytes);
+#endif
 
   for (uint8_t j = 0; j < NumOfBytes; j++)
   {
     Buff = Data[j];
     for (uint8_t i = 0; i < 8; ++i, Buff >>= 1)
     {
+      // Data changes right after the falling edge to get the whole low time
+      // as setup time
       TM1629_WRITE_CLK(Handler, 0);
-      TM1629_DELAY_US(Handler, 1);
       TM1629_WRITE_DIO(Handler, Buff & 0x01);
+      TM1629_DELAY_TIMING(Handler, ClockLowNs);
       TM1629_WRITE_CLK(Handler, 1);
-      TM1629_DELAY_US(Handler, 1);
+      TM1629_DELAY_TIMING(Handler, ClockHighNs);
     }
   }
 
@@ -192,8 +592,16 @@ TM1629_ReadBytesGPIO(TM1629_Handler_t *Handler,
 {
   uint8_t Buff = 0;
 
-  TM1629_DIR_DIO(Handler, 0);
-  TM1629_DELAY_US(Handler, 5);
+  TM1629_SetDirDIO(Handler, DIR_DIO_INPUT);
+  TM1629_DELAY_TIMING(Handler, TurnaroundNs);
+
+  if (TM1629_CHECK_PLATFORM_READ_BUFFER(Handler))
+    return TM1629_READ_BUFFER(Handler, Data, NumOfBytes);
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+  if (TM1629_CHECK_PLATFORM_MMIO(Handler))
+    return TM1629_ReadBytesMMIO(Handler, Data, NumOfBytes);
+#endif
 
   for (uint8_t j = 0; j < NumOfBytes; j++)
   {
@@ -201,35 +609,236 @@ TM1629_ReadBytesGPIO(TM1629_Handler_t *Handler,
     for (uint8_t i = 0; i < 8; i++)
     {
       TM1629_WRITE_CLK(Handler, 0);
-      TM1629_DELAY_US(Handler, 1);
+      TM1629_DELAY_TIMING(Handler, ClockLowNs);
       TM1629_WRITE_CLK(Handler, 1);
       Buff |= (TM1629_READ_DIO(Handler) << i);
-      TM1629_DELAY_US(Handler, 1);
+      TM1629_DELAY_TIMING(Handler, ClockHighNs);
     }
 
     Data[j] = Buff;
-    TM1629_DELAY_US(Handler, 2);
+    TM1629_DELAY_TIMING(Handler, ByteGapNs);
   }
 
   return 0;
 }
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+static uint32_t
+TM1629_Waveform_Word(TM1629_Handler_t *Handler,
+                     uint8_t STB, uint8_t CLK, uint8_t DIO)
+{
+  uint32_t Pins = Handler->Platform.GPIO.Waveform.STBMask |
+                  Handler->Platform.GPIO.Waveform.CLKMask |
+                  Handler->Platform.GPIO.Waveform.DIOMask;
+  uint32_t High = 0;
+
+  if (STB)
+    High |= Handler->Platform.GPIO.Waveform.STBMask;
+  if (CLK)
+    High |= Handler->Platform.GPIO.Waveform.CLKMask;
+  if (DIO)
+    High |= Handler->Platform.GPIO.Waveform.DIOMask;
+
+  if (Handler->Platform.GPIO.Waveform.Format == TM1629_WAVEFORM_FORMAT_SET_RESET)
+    return High | ((Pins & ~High) << 16);
+
+  return (Handler->Platform.GPIO.Waveform.Base & ~Pins) | High;
+}
+
+static inline uint16_t
+TM1629_Waveform_Ticks(TM1629_Handler_t *Handler, uint16_t DelayNs)
+{
+  uint16_t TickNs = Handler->Platform.GPIO.Waveform.TickNs;
+
+  // Each level stays on the port for at least one word
+  if (!TickNs || DelayNs <= TickNs)
+    return 1;
+
+  return (DelayNs + TickNs - 1) / TickNs;
+}
+
+static inline uint32_t *
+TM1629_Waveform_Fill(uint32_t *Word, uint32_t Value, uint16_t Count)
+{
+  while (Count--)
+    *Word++ = Value;
+  return Word;
+}
+
+/**
+ * @brief  Compile a write transaction to port words (same edge order as
+ *         TM1629_WriteBytesGPIO)
+ * @retval Number of words, 0 if the buffer is too small
+ */
+static uint16_t
+TM1629_Waveform_Compile(TM1629_Handler_t *Handler,
+                        const uint8_t *Data, uint8_t NumOfBytes)
+{
+  uint32_t *Word = Handler->Platform.GPIO.Waveform.Buffer;
+  uint16_t Low = TM1629_Waveform_Ticks(Handler, Handler->Timing.ClockLowNs);
+  uint16_t High = TM1629_Waveform_Ticks(Handler, Handler->Timing.ClockHighNs);
+  uint16_t Strobe = TM1629_Waveform_Ticks(Handler, Handler->Timing.StrobeNs);
+  uint32_t NumOfWords = 1 + (uint32_t)NumOfBytes * 8 * (Low + High) + Strobe;
+  uint32_t Words[2][2];
+  uint8_t Bit = 1;
+
+  if (!Word || NumOfWords > Handler->Platform.GPIO.Waveform.Size)
+    return 0;
+
+  // Words with STB low by CLK and DIO levels
+  for (uint8_t CLK = 0; CLK < 2; CLK++)
+    for (uint8_t DIO = 0; DIO < 2; DIO++)
+      Words[CLK][DIO] = TM1629_Waveform_Word(Handler, 0, CLK, DIO);
+
+  // STB falls while CLK and DIO are idle
+  *Word++ = Words[1][1];
+
+  for (uint8_t j = 0; j < NumOfBytes; j++)
+  {
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      Bit = (Data[j] >> i) & 0x01;
+      Word = TM1629_Waveform_Fill(Word, Words[0][Bit], Low);
+      Word = TM1629_Waveform_Fill(Word, Words[1][Bit], High);
+    }
+  }
+
+  // STB pulse width before the next transaction
+  TM1629_Waveform_Fill(Word, TM1629_Waveform_Word(Handler, 1, 1, Bit), Strobe);
+
+  return (uint16_t)NumOfWords;
+}
+
+/**
+ * @brief  Make the waveform buffer hold a write transaction
+ * @retval 1 if the buffer holds the transaction, 0 if it does not fit
+ */
+static uint8_t
+TM1629_Waveform_Prepare(TM1629_Handler_t *Handler,
+                        const uint8_t *Data, uint8_t NumOfBytes)
+{
+  uint8_t Cached = (Handler->WaveformBytes == NumOfBytes);
+
+  for (uint8_t i = 0; i < NumOfBytes && Cached; i++)
+    Cached = (Handler->WaveformFrame[i] == Data[i]);
+
+  if (Cached)
+    return 1;
+
+  Handler->WaveformBytes = 0;
+  if (NumOfBytes > TM1629_FRAME_SIZE)
+    return 0;
+
+  Handler->WaveformWords = TM1629_Waveform_Compile(Handler, Data, NumOfBytes);
+  if (!Handler->WaveformWords)
+    return 0;
+
+  for (uint8_t i = 0; i < NumOfBytes; i++)
+    Handler->WaveformFrame[i] = Data[i];
+  Handler->WaveformBytes = NumOfBytes;
+
+  return 1;
+}
+
+static int8_t
+TM1629_Waveform_Write(TM1629_Handler_t *Handler, TM1629_TraceKind_t Kind,
+                      const uint8_t *Data, uint8_t NumOfBytes)
+{
+  int8_t Result = 0;
+
+  TM1629_TRACE(Handler, TraceBegin, Kind, Data[0], NumOfBytes - 1);
+  TM1629_STATS_ADD(Handler, Transactions, 1);
+  TM1629_STATS_ADD(Handler, BytesWritten, NumOfBytes);
+  TM1629_STATS_ADD(Handler, BitsClocked, 8 * NumOfBytes);
+#if (TM1629_CONFIG_ENABLE_STATS)
+  if (TM1629_CHECK_PLATFORM_GET_TIME_US(Handler))
+    Handler->BusyStartUs = TM1629_GET_TIME_US(Handler);
+#endif
+
+  TM1629_SetDirDIO(Handler, DIR_DIO_OUTPUT);
+  Result = TM1629_PLAY_WAVEFORM(Handler, Handler->Platform.GPIO.Waveform.Buffer,
+                                Handler->WaveformWords);
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+  if (TM1629_CHECK_PLATFORM_GET_TIME_US(Handler))
+    Handler->Stats.BusyUs += TM1629_GET_TIME_US(Handler) - Handler->BusyStartUs;
+#endif
+  TM1629_TRACE(Handler, TraceEnd, Kind, Data[0], NumOfBytes - 1);
+
+  return TM1629_CHECK_RES_PLATFORM(Result) ? 0 : -1;
+}
+#endif
 #endif
 
 #if (TM1629_CONFIG_SUPPORT_SPI)
+static inline uint8_t
+TM1629_ReverseBits(uint8_t Data)
+{
+  static const uint8_t ReverseNibble[16] =
+  {
+    0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+    0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+  };
+
+  return (ReverseNibble[Data & 0x0F] << 4) | ReverseNibble[Data >> 4];
+}
+
 static inline int8_t
 TM1629_WriteBytesSPI(TM1629_Handler_t *Handler,
                      const uint8_t *Data, uint8_t NumOfBytes)
 {
-  // TODO: Implement SPI communication
-  return -1;
+  uint8_t *Buff = Handler->SPIBuffer.Bytes;
+  uint8_t Len = 0;
+
+  while (NumOfBytes)
+  {
+    Len = (NumOfBytes > TM1629_FRAME_SIZE) ? TM1629_FRAME_SIZE : NumOfBytes;
+
+    if (Handler->Platform.SPI.MSBFirst)
+    {
+      for (uint8_t i = 0; i < Len; i++)
+        Buff[i] = TM1629_ReverseBits(Data[i]);
+    }
+    else
+    {
+      for (uint8_t i = 0; i < Len; i++)
+        Buff[i] = Data[i];
+    }
+
+    if (!TM1629_CHECK_RES_PLATFORM(TM1629_SPI_WRITE(Handler, Buff, Len)))
+      return -1;
+
+    Data += Len;
+    NumOfBytes -= Len;
+  }
+
+  return 0;
 }
 
 static inline int8_t
 TM1629_ReadBytesSPI(TM1629_Handler_t *Handler,
                     uint8_t *Data, uint8_t NumOfBytes)
 {
-  // TODO: Implement SPI communication
-  return -1;
+  uint8_t *Buff = Handler->SPIBuffer.Bytes;
+
+  if (NumOfBytes > TM1629_FRAME_SIZE)
+    return -1;
+
+  if (!TM1629_CHECK_RES_PLATFORM(TM1629_SPI_READ(Handler, Buff, NumOfBytes)))
+    return -1;
+
+  if (Handler->Platform.SPI.MSBFirst)
+  {
+    for (uint8_t i = 0; i < NumOfBytes; i++)
+      Data[i] = TM1629_ReverseBits(Buff[i]);
+  }
+  else
+  {
+    for (uint8_t i = 0; i < NumOfBytes; i++)
+      Data[i] = Buff[i];
+  }
+
+  return 0;
 }
 #endif
 
@@ -237,6 +846,9 @@ static int8_t
 TM1629_WriteBytes(TM1629_Handler_t *Handler,
                   const uint8_t *Data, uint8_t NumOfBytes)
 {
+  TM1629_STATS_ADD(Handler, BytesWritten, NumOfBytes);
+  TM1629_STATS_ADD(Handler, BitsClocked, 8 * NumOfBytes);
+
 #if (TM1629_CONFIG_SUPPORT_GPIO && TM1629_CONFIG_SUPPORT_SPI)
   if (TM1629_IS_COMMUNICATION_GPIO(Handler))
     return TM1629_WriteBytesGPIO(Handler, Data, NumOfBytes);
@@ -255,7 +867,10 @@ static int8_t
 TM1629_ReadBytes(TM1629_Handler_t *Handler,
                  uint8_t *Data, uint8_t NumOfBytes)
 {
-  #if (TM1629_CONFIG_SUPPORT_GPIO && TM1629_CONFIG_SUPPORT_SPI)
+  TM1629_STATS_ADD(Handler, BytesRead, NumOfBytes);
+  TM1629_STATS_ADD(Handler, BitsClocked, 8 * NumOfBytes);
+
+#if (TM1629_CONFIG_SUPPORT_GPIO && TM1629_CONFIG_SUPPORT_SPI)
   if (TM1629_IS_COMMUNICATION_GPIO(Handler))
     return TM1629_ReadBytesGPIO(Handler, Data, NumOfBytes);
   else
@@ -269,589 +884,1953 @@ TM1629_ReadBytes(TM1629_Handler_t *Handler,
   return -128;
 }
 
+/**
+ * @brief  Send a STB framed write transaction
+ */
 static int8_t
-TM1629_SetMultipleDisplayRegister(TM1629_Handler_t *Handler,
-                                  const uint8_t *DigitData,
+TM1629_WriteFrame(TM1629_Handler_t *Handler, TM1629_TraceKind_t Kind,
+                  const uint8_t *Data, uint8_t NumOfBytes)
+{
+  int8_t Result = 0;
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+  if (TM1629_IS_COMMUNICATION_GPIO(Handler) &&
+      TM1629_CHECK_PLATFORM_PLAY_WAVEFORM(Handler) &&
+      TM1629_Waveform_Prepare(Handler, Data, NumOfBytes))
+    return TM1629_Waveform_Write(Handler, Kind, Data, NumOfBytes);
+#endif
+
+  TM1629_StartComunication(Handler, Kind, Data[0], NumOfBytes - 1);
+  Result = TM1629_WriteBytes(Handler, Data, NumOfBytes);
+  TM1629_StopComunication(Handler, Kind, Data[0], NumOfBytes - 1);
+
+  return Result;
+}
+
+static int8_t
+TM1629_SendDataCommand(TM1629_Handler_t *Handler, uint8_t Data)
+{
+  int8_t Result = 0;
+
+  // Data setting command is sent only if the chip is in another mode
+  if (Handler->DataCommand == Data)
+  {
+    TM1629_STATS_ADD(Handler, CommandsSuppressed, 1);
+    return 0;
+  }
+
+  Result = TM1629_WriteFrame(Handler, TM1629_TRACE_KIND_DATA_COMMAND, &Data, 1);
+  Handler->DataCommand = (Result >= 0) ? Data : 0;
+
+  return Result;
+}
+
+static int8_t
+TM1629_WriteDisplayRegister(TM1629_Handler_t *Handler,
+                            const uint8_t *DigitData,
+                            uint8_t StartAddr, uint8_t Count)
+{
+  uint8_t Frame[TM1629_FRAME_SIZE];
+
+  if (Count > TM1629_FRAME_SIZE - 1)
+    Count = TM1629_FRAME_SIZE - 1;
+
+  // Address command and data are sent in a single transfer
+  Frame[0] = COMMAND_ADDRESS_SETTING | StartAddr;
+  for (uint8_t i = 0; i < Count; i++)
+    Frame[i + 1] = DigitData[i];
+
+  return TM1629_WriteFrame(Handler, TM1629_TRACE_KIND_WRITE_DISPLAY, Frame, Count + 1);
+}
+
+#if (!TM1629_SUPPORT_SHADOW)
+static int8_t
+TM1629_SetMultipleDisplayRegister(TM1629_Handler_t *Handler,
+                                  const uint8_t *DigitData,
                                   uint8_t StartAddr, uint8_t Count)
 {
-  uint8_t Data = COMMAND_DATA_READING_WRITING_SETTING | 
+  uint8_t Data = COMMAND_DATA_READING_WRITING_SETTING |
                  COMMAND_DRWS_WRITE_DATA_TO_DISPLAY_REGISTER |
                  COMMAND_DRWS_AUTO_INCREASE_OF_ADDRESS |
                  COMMAND_DRWS_NORMAL_MODE;
 
-  TM1629_StartComunication(Handler);
-  TM1629_WriteBytes(Handler, &Data, 1);
-  TM1629_StopComunication(Handler);
+  if (TM1629_SendDataCommand(Handler, Data) < 0)
+    return -1;
 
-  Data = COMMAND_ADDRESS_SETTING | StartAddr;
+  return TM1629_WriteDisplayRegister(Handler, DigitData, StartAddr, Count);
+}
+#endif
 
-  TM1629_StartComunication(Handler);
-  TM1629_WriteBytes(Handler, &Data, 1);
-  TM1629_WriteBytes(Handler, DigitData, Count);
-  TM1629_StopComunication(Handler);
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+#if (TM1629_CONFIG_SUPPORT_BUS)
+static uint8_t
+TM1629_Bus_Busy(TM1629_Bus_t *Bus)
+{
+  // Attached chips share the DIO and CLK pins
+  for (uint8_t i = 0; i < Bus->NumOfHandlers; i++)
+  {
+    if (Bus->Handlers[i]->Async.Busy)
+      return 1;
+  }
 
   return 0;
 }
+#endif
+
+static uint8_t
+TM1629_Async_PinsBusy(TM1629_Handler_t *Handler)
+{
+#if (TM1629_CONFIG_SUPPORT_BUS)
+  // An asynchronous flush of another chip on the bus holds the pins too
+  if (Handler->Bus)
+    return TM1629_Bus_Busy(Handler->Bus);
+#endif
+
+  return Handler->Async.Busy;
+}
+#endif
 
+#if (TM1629_SUPPORT_SHADOW)
 static int8_t
-TM1629_ScanKeyRegs(TM1629_Handler_t *Handler, uint8_t *KeyRegs)
+TM1629_FlushDisplayRegister(TM1629_Handler_t *Handler)
 {
-  uint8_t Data = COMMAND_DATA_READING_WRITING_SETTING | 
-                 COMMAND_DRWS_READ_KEY_SCANNING_DATA |
-                 COMMAND_DRWS_AUTO_INCREASE_OF_ADDRESS |
-                 COMMAND_DRWS_NORMAL_MODE;
+  TM1629_FlushPlan_t Plan;
+  uint8_t Addr = 0;
 
-  TM1629_StartComunication(Handler);
-  TM1629_WriteBytes(Handler, &Data, 1);
-  TM1629_ReadBytes(Handler, KeyRegs, 4);
-  TM1629_StopComunication(Handler);
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_Async_PinsBusy(Handler))
+    return -1;
+#endif
+
+  if (!Handler->DirtyMask)
+    return 0;
+
+  TM1629_PlanFlush(Handler, &Plan);
+
+  // Skipped (and counted as suppressed) when Plan.SendDataCommand is 0
+  if (TM1629_SendDataCommand(Handler, Plan.DataCommand) < 0)
+    return -1;
+
+  for (uint8_t i = 0; i < Plan.NumOfWrites; i++)
+  {
+    Addr = Plan.Writes[i].Addr;
+
+    if (TM1629_WriteDisplayRegister(Handler, &Handler->DisplayRegister[Addr],
+                                    Addr, Plan.Writes[i].Count) < 0)
+      return -1;
+
+    for (uint8_t j = 0; j < Plan.Writes[i].Count; j++, Addr++)
+      Handler->DirtyMask &= ~(1u << Addr);
+  }
 
   return 0;
 }
 
-static void
-TM1629_HexTo7Seg(const uint8_t *Hex, uint8_t *Data, uint8_t Count)
+static int8_t
+TM1629_UpdateDisplayRegister(TM1629_Handler_t *Handler)
 {
-  uint8_t DecimalPoint = 0;
-  uint8_t Digit = 0;
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+  if (Handler->Buffered)
+    return 0;
+#endif
 
-  if (!Hex || !Data)
-    return;
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  // Changes stay in the shadow until the next flush
+  if (TM1629_Async_PinsBusy(Handler))
+    return 0;
+#endif
 
-  for (uint8_t i = 0; i < Count; i++)
-  {
-    DecimalPoint = Hex[i] & TM1629_DECIMAL_POINT;
-    Digit = Hex[i] & (~TM1629_DECIMAL_POINT);
+  return TM1629_FlushDisplayRegister(Handler);
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+static inline TM1629_TraceKind_t
+TM1629_Async_Kind(uint8_t Command)
+{
+  if ((Command & COMMAND_MASK) == COMMAND_DATA_READING_WRITING_SETTING)
+    return TM1629_TRACE_KIND_DATA_COMMAND;
+
+  return TM1629_TRACE_KIND_WRITE_DISPLAY;
+}
+
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+static uint32_t
+TM1629_Async_TickNs(TM1629_Handler_t *Handler)
+{
+  uint32_t Period = Handler->Timing.ClockHighNs;
+
+  // One tick must cover every delay of a write transaction
+  if (Handler->Timing.ClockLowNs > Period)
+    Period = Handler->Timing.ClockLowNs;
+  if (Handler->Timing.StrobeNs > Period)
+    Period = Handler->Timing.StrobeNs;
+
+  return Period;
+}
+#endif
+
+static void
+TM1629_Async_Finish(TM1629_Handler_t *Handler, TM1629_Result_t Result)
+{
+  TM1629_Async_t *Async = &Handler->Async;
 
-    if (Digit <= 15)
+  if (Result != TM1629_OK)
+  {
+    // Close the transaction in progress like any other (trace end and busy
+    // time)
+    if (Async->Started)
     {
-      Data[i] = HexTo7Seg[Digit] | DecimalPoint;
+      const uint8_t *Frame = &Async->Bytes[Async->Index];
+      uint8_t Length = Async->Lengths[Async->Frame];
+
+      TM1629_ReleaseComunication(Handler, TM1629_Async_Kind(Frame[0]),
+                                 Frame[0], Length - 1);
+      Async->Started = 0;
     }
     else
     {
-      switch (Digit)
-      {
-      case 'A':
-      case 'a':
-        Data[i] = HexTo7Seg[0x0A] | DecimalPoint;
-        break;
-
-      case 'B':
-      case 'b':
-        Data[i] = HexTo7Seg[0x0B] | DecimalPoint;
-        break;
-
-      case 'C':
-      case 'c':
-        Data[i] = HexTo7Seg[0x0C] | DecimalPoint;
-        break;
-
-      case 'D':
-      case 'd':
-        Data[i] = HexTo7Seg[0x0D] | DecimalPoint;
-        break;
-
-      case 'E':
-      case 'e':
-        Data[i] = HexTo7Seg[0x0E] | DecimalPoint;
-        break;
-
-      case 'F':
-      case 'f':
-        Data[i] = HexTo7Seg[0x0F] | DecimalPoint;
-        break;
-
-      default:
-        Data[i] = 0;
-        break;
-      }
+      TM1629_WRITE_STB(Handler, 1);
     }
+
+    // State of the chip is unknown, send everything again
+    Handler->DataCommand = 0;
+    Handler->DirtyMask = 0xFFFF;
   }
-}
 
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+  if (Async->Timer)
+  {
+    TM1629_TIMER_STOP(Handler);
+    Async->Timer = 0;
+  }
+#endif
 
-static void
-TM1629_StringTo7Seg(const char *Str, uint8_t *Data, uint8_t Count)
-{
-  uint8_t DecimalPoint = 0;
-  char Ch = 0;
+  Async->Busy = 0;
+  if (Async->Done)
+    Async->Done(Handler, Result);
+}
 
-  if (!Str|| !Data)
-    return;
+/**
+ * @brief  Make the next edge of the asynchronous flush
+ * @param  Wait: Wait for the delays of the timing profile after the edge
+ * @retval 0 on success, -1 if a platform function failed
+ */
+static int8_t
+TM1629_Async_Step(TM1629_Handler_t *Handler, uint8_t Wait)
+{
+  TM1629_Async_t *Async = &Handler->Async;
+  const uint8_t *Frame = &Async->Bytes[Async->Index];
+  uint8_t Length = Async->Lengths[Async->Frame];
+  uint8_t Bit = 0;
+  int8_t Result = 0;
 
-  for (uint8_t i = 0; i < Count; i++)
+  if (!Async->Started)
   {
-    if (Str[i] == '.')
-      DecimalPoint = TM1629_DECIMAL_POINT;
-    else
-      DecimalPoint = Str[i] & TM1629_DECIMAL_POINT;
-    
-    Ch = Str[i] & (~TM1629_DECIMAL_POINT);
-
-    // numbers 0 - 9
-    if (Ch >= '0' && Ch <= '9')
+    TM1629_STATS_ADD(Handler, BytesWritten, Length);
+    TM1629_STATS_ADD(Handler, BitsClocked, 8 * Length);
+    TM1629_StartComunication(Handler, TM1629_Async_Kind(Frame[0]),
+                             Frame[0], Length - 1);
+    Result |= TM1629_SetDirDIO(Handler, DIR_DIO_OUTPUT);
+    Async->Started = 1;
+  }
+  else if (Async->Sent < Length)
+  {
+    // Same edge order as TM1629_WriteBytesGPIO
+    if (!(Async->Edge & 0x01))
     {
-      Data[i] = HexTo7Seg[Ch - '0'] | DecimalPoint;
+      Bit = (Frame[Async->Sent] >> (Async->Edge >> 1)) & 0x01;
+      Result |= TM1629_WRITE_CLK(Handler, 0);
+      Result |= TM1629_WRITE_DIO(Handler, Bit);
+      if (Wait)
+        TM1629_DELAY_TIMING(Handler, ClockLowNs);
     }
     else
     {
-      switch (Ch)
-      {
-      case 'A':
-      case 'a':
-        Data[i] = HexTo7Seg[0x0A] | DecimalPoint;
-        break;
-
-      case 'B':
-      case 'b':
-        Data[i] = HexTo7Seg[0x0B] | DecimalPoint;
-        break;
-
-      case 'C':
-      case 'c':
-        Data[i] = HexTo7Seg[0x0C] | DecimalPoint;
-        break;
-
-      case 'D':
-      case 'd':
-        Data[i] = HexTo7Seg[0x0D] | DecimalPoint;
-        break;
-
-      case 'E':
-      case 'e':
-        Data[i] = HexTo7Seg[0x0E] | DecimalPoint;
-        break;
-
-      case 'F':
-      case 'f':
-        Data[i] = HexTo7Seg[0x0F] | DecimalPoint;
-        break;
-
-      case 'g':
-        Data[i] = HexTo7Seg[0x10] | DecimalPoint;
-        break;
-
-      case 'G':
-        Data[i] = HexTo7Seg[0x11] | DecimalPoint;
-        break;
-
-      case 'h':
-        Data[i] = HexTo7Seg[0x12] | DecimalPoint;
-        break;
-
-      case 'H':
-        Data[i] = HexTo7Seg[0x13] | DecimalPoint;
-        break;
-
-      case 'i':
-        Data[i] = HexTo7Seg[0x14] | DecimalPoint;
-        break;
-
-      case 'I':
-        Data[i] = HexTo7Seg[0x15] | DecimalPoint;
-        break;
-
-      case 'j':
-      case 'J':
-        Data[i] = HexTo7Seg[0x16] | DecimalPoint;
-        break;
-
-      case 'l':
-        Data[i] = HexTo7Seg[0x17] | DecimalPoint;
-        break;
-
-      case 'L':
-        Data[i] = HexTo7Seg[0x18] | DecimalPoint;
-        break;
-
-      case 'n':
-        Data[i] = HexTo7Seg[0x19] | DecimalPoint;
-        break;
-
-      case 'N':
-        Data[i] = HexTo7Seg[0x1A] | DecimalPoint;
-        break;
-
-      case 'o':
-        Data[i] = HexTo7Seg[0x1B] | DecimalPoint;
-        break;
-
-      case 'O':
-        Data[i] = HexTo7Seg[0x1C] | DecimalPoint;
-        break;
-
-      case 'p':
-      case 'P':
-        Data[i] = HexTo7Seg[0x1D] | DecimalPoint;
-        break;
-
-      case 'q':
-      case 'Q':
-        Data[i] = HexTo7Seg[0x1E] | DecimalPoint;
-        break;
-
-      case 'r':
-      case 'R':
-        Data[i] = HexTo7Seg[0x1F] | DecimalPoint;
-        break;
-
-      case 's':
-      case 'S':
-        Data[i] = HexTo7Seg[0x20] | DecimalPoint;
-        break;
-
-      case 't':
-      case 'T':
-        Data[i] = HexTo7Seg[0x21] | DecimalPoint;
-        break;
-
-      case 'u':
-        Data[i] = HexTo7Seg[0x22] | DecimalPoint;
-        break;
-
-      case 'U':
-        Data[i] = HexTo7Seg[0x23] | DecimalPoint;
-        break;
-
-      case 'y':
-      case 'Y':
-        Data[i] = HexTo7Seg[0x24] | DecimalPoint;
-        break;
-
-      case '_':
-        Data[i] = HexTo7Seg[0x25] | DecimalPoint;
-        break;
-
-      case '-':
-        Data[i] = HexTo7Seg[0x26] | DecimalPoint;
-        break;
-
-      case '~':
-        Data[i] = HexTo7Seg[0x27] | DecimalPoint;
-        break;
-
-      default:
-        Data[i] = 0;
-        break;
-      }
+      Result |= TM1629_WRITE_CLK(Handler, 1);
+      if (Wait)
+        TM1629_DELAY_TIMING(Handler, ClockHighNs);
+    }
+
+    if (++Async->Edge == 16)
+    {
+      Async->Edge = 0;
+      Async->Sent++;
     }
   }
+  else
+  {
+    if (Wait)
+      TM1629_StopComunication(Handler, TM1629_Async_Kind(Frame[0]),
+                              Frame[0], Length - 1);
+    else
+      TM1629_ReleaseComunication(Handler, TM1629_Async_Kind(Frame[0]),
+                                 Frame[0], Length - 1);
+    Async->Started = 0;
+    Async->Sent = 0;
+    Async->Index += Length;
+
+    if (++Async->Frame == Async->NumOfFrames)
+      TM1629_Async_Finish(Handler, TM1629_OK);
+  }
+
+  if (Result < 0)
+  {
+    TM1629_Async_Finish(Handler, TM1629_FAIL);
+    return -1;
+  }
+
+  return 0;
 }
+#endif
 
+#if (TM1629_CONFIG_SUPPORT_BUS)
+static inline uint32_t
+TM1629_Bus_ValidMask(TM1629_Bus_t *Bus, uint32_t Mask)
+{
+  if (Bus->NumOfHandlers < 32)
+    Mask &= (1ul << Bus->NumOfHandlers) - 1;
 
+  return Mask;
+}
 
-/**
- ==================================================================================
-                           ##### Common Functions #####                            
- ==================================================================================
- */
+static void
+TM1629_Bus_WriteSTB(TM1629_Bus_t *Bus, uint32_t Mask, uint8_t State)
+{
+  if (Bus->WriteSTBMask)
+  {
+    Bus->WriteSTBMask(Bus->Context, Mask, State);
+    return;
+  }
 
-/**
- * @brief  Initialize TM1629.
- * @param  Handler: Pointer to handler
- * @param  Type: Determine the type of display
- *         - TM1629_DISPLAY_TYPE_COM_CATHODE: Common-Cathode
- *         - TM1629_DISPLAY_TYPE_COM_ANODE:   Common-Anode
- * @note   If 'TM1629_CONFIG_SUPPORT_COM_ANODE' switch is set to 0, the 'Type'
- *         argument will be ignored 
- *         
- * @retval TM1629_Result_t
- *         - TM1629_OK: Operation was successful.
- */
-TM1629_Result_t
-TM1629_Init(TM1629_Handler_t *Handler, TM1629_DisplayType_t Type)
+  for (uint8_t i = 0; i < Bus->NumOfHandlers; i++)
+  {
+    if (Mask & (1ul << i))
+      TM1629_WRITE_STB(Bus->Handlers[i], State);
+  }
+}
+
+static int8_t
+TM1629_Bus_WriteBytes(TM1629_Bus_t *Bus, uint32_t Mask, TM1629_TraceKind_t Kind,
+                      const uint8_t *Data, uint8_t NumOfBytes)
 {
-  Handler->DisplayType = TM1629_DISPLAY_TYPE_COM_CATHODE;
+  TM1629_Handler_t *Handler = 0;
+  int8_t Result = 0;
 
-#if TM1629_CONFIG_SUPPORT_COM_ANODE
-  if (Type == TM1629_DISPLAY_TYPE_COM_CATHODE)
-    Handler->DisplayType = TM1629_DISPLAY_TYPE_COM_CATHODE;
+  // The first selected chip clocks the data for all of them
+  for (uint8_t i = 0; i < Bus->NumOfHandlers && !Handler; i++)
+  {
+    if (Mask & (1ul << i))
+      Handler = Bus->Handlers[i];
+  }
+
+  if (!Handler)
+    return 0;
+
+  TM1629_TRACE(Handler, TraceBegin, Kind, Data[0], NumOfBytes - 1);
+  TM1629_STATS_ADD(Handler, Transactions, 1);
+#if (TM1629_CONFIG_ENABLE_STATS)
+  if (TM1629_CHECK_PLATFORM_GET_TIME_US(Handler))
+    Handler->BusyStartUs = TM1629_GET_TIME_US(Handler);
+#endif
+  TM1629_Bus_WriteSTB(Bus, Mask, 0);
+  Result = TM1629_WriteBytes(Handler, Data, NumOfBytes);
+  TM1629_Bus_WriteSTB(Bus, Mask, 1);
+#if (TM1629_CONFIG_ENABLE_STATS)
+  if (TM1629_CHECK_PLATFORM_GET_TIME_US(Handler))
+    Handler->Stats.BusyUs += TM1629_GET_TIME_US(Handler) - Handler->BusyStartUs;
+#endif
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+  if (TM1629_IS_COMMUNICATION_GPIO(Handler))
+    TM1629_DELAY_TIMING(Handler, StrobeNs);
+#endif
+  TM1629_TRACE(Handler, TraceEnd, Kind, Data[0], NumOfBytes - 1);
+
+  return Result;
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+static uint8_t
+TM1629_WideBus_Busy(TM1629_WideBus_t *Bus)
+{
+  // Attached chips share the CLK and STB pins
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+  {
+    if (Bus->Handlers[n]->Async.Busy)
+      return 1;
+  }
+
+  return 0;
+}
+#endif
+
+static inline void
+TM1629_WideBus_Delay(TM1629_WideBus_t *Bus, uint16_t DelayNs)
+{
+  if (!DelayNs)
+    return;
+
+  if (Bus->DelayNs)
+    Bus->DelayNs(Bus->Context, DelayNs);
   else
-    Handler->DisplayType = TM1629_DISPLAY_TYPE_COM_ANODE;
+    Bus->DelayUs(Bus->Context, (DelayNs + 999) / 1000);
+}
+
+static inline void
+TM1629_WideBus_StartCommunication(TM1629_WideBus_t *Bus)
+{
+#if (TM1629_CONFIG_ENABLE_STATS)
+  // Each chip sees a transaction of its own, timed by its own clock
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+  {
+    TM1629_Handler_t *Handler = Bus->Handlers[n];
+
+    TM1629_STATS_ADD(Handler, Transactions, 1);
+    if (TM1629_CHECK_PLATFORM_GET_TIME_US(Handler))
+      Handler->BusyStartUs = TM1629_GET_TIME_US(Handler);
+  }
 #endif
 
-  if (TM1629_CHECK_PLATFORM_INIT(Handler))
-    if (!TM1629_CHECK_RES_PLATFORM(TM1629_PLATFORM_INIT(Handler)))
-      return TM1629_FAIL;
+  Bus->WriteSTB(Bus->Context, 0);
+}
 
-  if (TM1629_IS_COMMUNICATION_GPIO(Handler))
+static inline void
+TM1629_WideBus_StopCommunication(TM1629_WideBus_t *Bus)
+{
+  Bus->WriteSTB(Bus->Context, 1);
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
   {
-    if (!TM1629_CHECK_PLATFORM_DIR_DIO(Handler) ||
-        !TM1629_CHECK_PLATFORM_WRITE_STB(Handler) ||
-        !TM1629_CHECK_PLATFORM_WRITE_DIO(Handler) ||
-        !TM1629_CHECK_PLATFORM_WRITE_CLK(Handler) ||
-        !TM1629_CHECK_PLATFORM_READ_DIO(Handler) ||
-        !TM1629_CHECK_PLATFORM_DELAY_US(Handler))
-      return TM1629_FAIL;
+    TM1629_Handler_t *Handler = Bus->Handlers[n];
+
+    if (TM1629_CHECK_PLATFORM_GET_TIME_US(Handler))
+      Handler->Stats.BusyUs += TM1629_GET_TIME_US(Handler) - Handler->BusyStartUs;
   }
-  else if (TM1629_IS_COMMUNICATION_SPI(Handler))
+#endif
+
+  TM1629_WideBus_Delay(Bus, Bus->Timing.StrobeNs);
+}
+
+static inline int8_t
+TM1629_WideBus_SetDirDIO(TM1629_WideBus_t *Bus, uint8_t Dir)
+{
+  if (Bus->DirDIO == Dir)
+    return 0;
+
+  if (Bus->DirPort(Bus->Context, Bus->PortMask, Dir) < 0)
   {
-    return TM1629_FAIL;
+    Bus->DirDIO = DIR_DIO_UNKNOWN;
+    return -1;
   }
 
-  return TM1629_OK;
+  Bus->DirDIO = Dir;
+  return 0;
 }
 
 /**
- * @brief  De-Initialize TM1629.
- * @param  Handler: Pointer to handler
- * @retval TM1629_Result_t
- *         - TM1629_OK: Operation was successful.
+ * @brief  Clock one byte to all chips
+ * @param  Words: Port value of each bit (LSB first)
  */
-TM1629_Result_t
-TM1629_DeInit(TM1629_Handler_t *Handler)
+static int8_t
+TM1629_WideBus_WriteWords(TM1629_WideBus_t *Bus, const uint32_t *Words)
 {
-  if (TM1629_CHECK_PLATFORM_DEINIT(Handler))
-    if (TM1629_CHECK_RES_PLATFORM(TM1629_PLATFORM_DEINIT(Handler)))
-      return TM1629_FAIL;
+  int8_t Result = 0;
 
-  return TM1629_OK;
-}
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    if (Bus->CLKMask)
+    {
+      // CLK falls together with the new data bits
+      Result |= Bus->WritePort(Bus->Context,
+                               Bus->PortMask | Bus->CLKMask, Words[i]);
+      TM1629_WideBus_Delay(Bus, Bus->Timing.ClockLowNs);
+      Result |= Bus->WritePort(Bus->Context, Bus->CLKMask, Bus->CLKMask);
+    }
+    else
+    {
+      Result |= Bus->WriteCLK(Bus->Context, 0);
+      Result |= Bus->WritePort(Bus->Context, Bus->PortMask, Words[i]);
+      TM1629_WideBus_Delay(Bus, Bus->Timing.ClockLowNs);
+      Result |= Bus->WriteCLK(Bus->Context, 1);
+    }
+    TM1629_WideBus_Delay(Bus, Bus->Timing.ClockHighNs);
+  }
 
+#if (TM1629_CONFIG_ENABLE_STATS)
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+  {
+    TM1629_STATS_ADD(Bus->Handlers[n], BytesWritten, 1);
+    TM1629_STATS_ADD(Bus->Handlers[n], BitsClocked, 8);
+  }
+#endif
 
+  return (Result < 0) ? -1 : 0;
+}
 
 /**
- ==================================================================================
-                        ##### Public Display Functions #####                       
- ==================================================================================
+ * @brief  Send the same byte to all chips
  */
+static int8_t
+TM1629_WideBus_WriteCommand(TM1629_WideBus_t *Bus, uint8_t Data)
+{
+  uint32_t Words[8];
+
+  if (TM1629_WideBus_SetDirDIO(Bus, DIR_DIO_OUTPUT) < 0)
+    return -1;
+
+  for (uint8_t i = 0; i < 8; i++, Data >>= 1)
+    Words[i] = (Data & 0x01) ? Bus->PortMask : 0;
+
+  return TM1629_WideBus_WriteWords(Bus, Words);
+}
 
 /**
- * @brief  Config display parameters
- * @param  Handler: Pointer to handler
- * @param  Brightness: Set brightness level
- *         - 0: Display pulse width is set as 1/16
- *         - 1: Display pulse width is set as 2/16
- *         - 2: Display pulse width is set as 4/16
- *         - 3: Display pulse width is set as 10/16
- *         - 4: Display pulse width is set as 11/16
- *         - 5: Display pulse width is set as 12/16
- *         - 6: Display pulse width is set as 13/16
- *         - 7: Display pulse width is set as 14/16
- * 
- * @param  DisplayState: Set display ON or OFF
- *         - TM1629_DISPLAY_STATE_OFF: Set display state OFF
- *         - TM1629_DISPLAY_STATE_ON: Set display state ON
+ * @brief  Send a different byte stream to each chip
+ * @param  Data: Data[n] points to the bytes of the n-th attached handler
+ */
+static int8_t
+TM1629_WideBus_WriteBytes(TM1629_WideBus_t *Bus,
+                          const uint8_t *const *Data, uint8_t NumOfBytes)
+{
+  uint32_t Words[8];
+  uint8_t Buff = 0;
+
+  if (TM1629_WideBus_SetDirDIO(Bus, DIR_DIO_OUTPUT) < 0)
+    return -1;
+
+  for (uint8_t j = 0; j < NumOfBytes; j++)
+  {
+    // Transpose j-th byte of all chips into one port word per bit
+    for (uint8_t i = 0; i < 8; i++)
+      Words[i] = 0;
+
+    for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+    {
+      Buff = Data[n][j];
+      for (uint8_t i = 0; Buff; i++, Buff >>= 1)
+      {
+        if (Buff & 0x01)
+          Words[i] |= Bus->DIOMask[n];
+      }
+    }
+
+    if (TM1629_WideBus_WriteWords(Bus, Words) < 0)
+      return -1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief  Read bytes of all chips in parallel
+ * @param  Data: Data[n] receives the bytes of the n-th attached handler
+ */
+static int8_t
+TM1629_WideBus_ReadBytes(TM1629_WideBus_t *Bus,
+                         uint8_t (*Data)[4], uint8_t NumOfBytes)
+{
+  uint32_t Port = 0;
+  int8_t Result = 0;
+
+  if (TM1629_WideBus_SetDirDIO(Bus, DIR_DIO_INPUT) < 0)
+    return -1;
+  TM1629_WideBus_Delay(Bus, Bus->Timing.TurnaroundNs);
+
+  for (uint8_t j = 0; j < NumOfBytes; j++)
+  {
+    for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+      Data[n][j] = 0;
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      if (Bus->CLKMask)
+      {
+        Result |= Bus->WritePort(Bus->Context, Bus->CLKMask, 0);
+        TM1629_WideBus_Delay(Bus, Bus->Timing.ClockLowNs);
+        Result |= Bus->WritePort(Bus->Context, Bus->CLKMask, Bus->CLKMask);
+      }
+      else
+      {
+        Result |= Bus->WriteCLK(Bus->Context, 0);
+        TM1629_WideBus_Delay(Bus, Bus->Timing.ClockLowNs);
+        Result |= Bus->WriteCLK(Bus->Context, 1);
+      }
+      Result |= Bus->ReadPort(Bus->Context, &Port);
+
+      for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+      {
+        if (Port & Bus->DIOMask[n])
+          Data[n][j] |= (1 << i);
+      }
+      TM1629_WideBus_Delay(Bus, Bus->Timing.ClockHighNs);
+    }
+
+    TM1629_WideBus_Delay(Bus, Bus->Timing.ByteGapNs);
+  }
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+  {
+    TM1629_STATS_ADD(Bus->Handlers[n], BytesRead, NumOfBytes);
+    TM1629_STATS_ADD(Bus->Handlers[n], BitsClocked, 8 * NumOfBytes);
+  }
+#endif
+
+  return (Result < 0) ? -1 : 0;
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_COM_ANODE)
+/**
+ * @brief  Transpose 8x8 bit matrix in place (bit c of Matrix[r] <=> bit r of
+ *         Matrix[c]) using 32-bit word operations
+ */
+static void
+TM1629_Transpose8x8(uint8_t *Matrix)
+{
+  uint32_t Lo = 0;
+  uint32_t Hi = 0;
+  uint32_t t = 0;
+
+  for (int8_t i = 3; i >= 0; i--)
+  {
+    Lo = (Lo << 8) | Matrix[i];
+    Hi = (Hi << 8) | Matrix[i + 4];
+  }
+
+  // Swap 1x1 blocks inside 2x2 blocks, then 2x2 blocks inside 4x4 blocks
+  t = (Lo ^ (Lo >> 7)) & 0x00AA00AA;
+  Lo ^= t ^ (t << 7);
+  t = (Hi ^ (Hi >> 7)) & 0x00AA00AA;
+  Hi ^= t ^ (t << 7);
+  t = (Lo ^ (Lo >> 14)) & 0x0000CCCC;
+  Lo ^= t ^ (t << 14);
+  t = (Hi ^ (Hi >> 14)) & 0x0000CCCC;
+  Hi ^= t ^ (t << 14);
+
+  // Swap 4x4 blocks
+  t = ((Lo >> 4) ^ Hi) & 0x0F0F0F0F;
+  Hi ^= t;
+  Lo ^= t << 4;
+
+  for (uint8_t i = 0; i < 4; i++, Lo >>= 8, Hi >>= 8)
+  {
+    Matrix[i] = (uint8_t)Lo;
+    Matrix[i + 4] = (uint8_t)Hi;
+  }
+}
+#endif
+
+static int8_t
+TM1629_ScanKeyRegs(TM1629_Handler_t *Handler, uint8_t *KeyRegs)
+{
+  uint8_t Data = COMMAND_DATA_READING_WRITING_SETTING | 
+                 COMMAND_DRWS_READ_KEY_SCANNING_DATA |
+                 COMMAND_DRWS_AUTO_INCREASE_OF_ADDRESS |
+                 COMMAND_DRWS_NORMAL_MODE;
+
+  TM1629_StartComunication(Handler, TM1629_TRACE_KIND_READ_KEYS, Data, 4);
+  Handler->DataCommand = (TM1629_WriteBytes(Handler, &Data, 1) >= 0) ? Data : 0;
+  TM1629_ReadBytes(Handler, KeyRegs, 4);
+  TM1629_StopComunication(Handler, TM1629_TRACE_KIND_READ_KEYS, Data, 4);
+
+  return 0;
+}
+
+static uint32_t
+TM1629_DecodeKeys(const uint8_t *KeyRegs)
+{
+  uint32_t KeysBuff = 0;
+  uint8_t Kn = 0x01;
+
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    for (int8_t j = 3; j >= 0; j--)
+    {
+      KeysBuff <<= 1;
+
+      if (KeyRegs[j] & (Kn << 4))
+        KeysBuff |= 1;
+
+      KeysBuff <<= 1;
+
+      if (KeyRegs[j] & Kn)
+        KeysBuff |= 1;
+    }
+
+    Kn <<= 1;
+  }
+
+  return KeysBuff;
+}
+
+/**
+ * @brief  Convert bytes through a 256-entry table
+ */
+static void
+TM1629_LookupTo7Seg(const uint8_t *Table,
+                    const uint8_t *In, uint8_t *Out, uint8_t Count)
+{
+  for (uint8_t i = 0; i < Count; i++)
+    Out[i] = Table[In[i]];
+}
+
+
+
+/**
+ ==================================================================================
+                           ##### Common Functions #####                            
+ ==================================================================================
+ */
+
+/**
+ * @brief  Initialize TM1629.
+ * @param  Handler: Pointer to handler
+ * @param  Type: Determine the type of display
+ *         - TM1629_DISPLAY_TYPE_COM_CATHODE: Common-Cathode
+ *         - TM1629_DISPLAY_TYPE_COM_ANODE:   Common-Anode
+ * @note   If 'TM1629_CONFIG_SUPPORT_COM_ANODE' switch is set to 0, the 'Type'
+ *         argument will be ignored 
+ *         
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_Init(TM1629_Handler_t *Handler, TM1629_DisplayType_t Type)
+{
+  Handler->DisplayType = TM1629_DISPLAY_TYPE_COM_CATHODE;
+
+#if TM1629_CONFIG_SUPPORT_COM_ANODE
+  if (Type == TM1629_DISPLAY_TYPE_COM_CATHODE)
+    Handler->DisplayType = TM1629_DISPLAY_TYPE_COM_CATHODE;
+  else
+    Handler->DisplayType = TM1629_DISPLAY_TYPE_COM_ANODE;
+#endif
+
+  Handler->DataCommand = 0;
+  Handler->DisplayControl = 0;
+
+#if (TM1629_SUPPORT_SHADOW)
+  // Content of display RAM is unknown, first flush clears it all
+  for (uint8_t i = 0; i < 16; i++)
+    Handler->DisplayRegister[i] = 0;
+  Handler->DirtyMask = 0xFFFF;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+  Handler->Buffered = 0;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  Handler->Async.Busy = 0;
+#endif
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+  TM1629_ResetStats(Handler);
+#endif
+
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  if (!Handler->Platform.Ops)
+    return TM1629_FAIL;
+#endif
+
+  if (TM1629_CHECK_PLATFORM_INIT(Handler))
+    if (!TM1629_CHECK_RES_PLATFORM(TM1629_PLATFORM_INIT(Handler)))
+      return TM1629_FAIL;
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+  if (TM1629_IS_COMMUNICATION_GPIO(Handler))
+  {
+    if (!TM1629_CHECK_PLATFORM_DIR_DIO(Handler) ||
+        !TM1629_CHECK_PLATFORM_PINS(Handler) ||
+        (!TM1629_CHECK_PLATFORM_DELAY_US(Handler) &&
+         !TM1629_CHECK_PLATFORM_DELAY_NS(Handler)))
+      return TM1629_FAIL;
+
+    Handler->Timing.ClockHighNs = TM1629_TIMING_DEFAULT_CLOCK_HIGH_NS;
+    Handler->Timing.ClockLowNs = TM1629_TIMING_DEFAULT_CLOCK_LOW_NS;
+    Handler->Timing.TurnaroundNs = TM1629_TIMING_DEFAULT_TURNAROUND_NS;
+    Handler->Timing.ByteGapNs = TM1629_TIMING_DEFAULT_BYTE_GAP_NS;
+    Handler->Timing.StrobeNs = TM1629_TIMING_DEFAULT_STROBE_NS;
+
+    Handler->DirDIO = DIR_DIO_UNKNOWN;
+    Handler->DirDIOSkipped = 0;
+    *TM1629_DirDIOState(Handler) = DIR_DIO_UNKNOWN;
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+    Handler->WaveformBytes = 0;
+#endif
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+    Handler->Calibration.Valid = 0;
+    if (TM1629_CHECK_PLATFORM_GET_TIME_NS(Handler))
+      TM1629_Calibrate(Handler);
+#endif
+  }
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+  if (TM1629_IS_COMMUNICATION_SPI(Handler))
+  {
+    if (!TM1629_CHECK_PLATFORM_WRITE_STB(Handler) ||
+        !TM1629_CHECK_PLATFORM_SPI_WRITE(Handler) ||
+        !TM1629_CHECK_PLATFORM_SPI_READ(Handler))
+      return TM1629_FAIL;
+  }
+#endif
+
+  return TM1629_OK;
+}
+
+/**
+ * @brief  De-Initialize TM1629.
+ * @param  Handler: Pointer to handler
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_DeInit(TM1629_Handler_t *Handler)
+{
+  if (TM1629_CHECK_PLATFORM_DEINIT(Handler))
+    if (TM1629_CHECK_RES_PLATFORM(TM1629_PLATFORM_DEINIT(Handler)))
+      return TM1629_FAIL;
+
+  return TM1629_OK;
+}
+
+/**
+ * @brief  Forget the cached chip state
+ * @param  Handler: Pointer to handler
+ * @note   The driver does not resend commands which do not change the chip
+ *         state. Call this function if the chip may have lost its state (e.g.
+ *         power cycle), so the next calls send every command again.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_ResetStateCache(TM1629_Handler_t *Handler)
+{
+  Handler->DataCommand = 0;
+  Handler->DisplayControl = 0;
+
+#if (TM1629_SUPPORT_SHADOW)
+  Handler->DirtyMask = 0xFFFF;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+  Handler->DirDIO = DIR_DIO_UNKNOWN;
+  *TM1629_DirDIOState(Handler) = DIR_DIO_UNKNOWN;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+  Handler->WaveformBytes = 0;
+#endif
+
+  return TM1629_OK;
+}
+
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+/**
+ * @brief  Get runtime statistics
+ * @param  Handler: Pointer to handler
+ * @param  Stats: Pointer to save the statistics
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_GetStats(TM1629_Handler_t *Handler, TM1629_Stats_t *Stats)
+{
+  *Stats = Handler->Stats;
+  return TM1629_OK;
+}
+
+
+/**
+ * @brief  Reset runtime statistics
+ * @param  Handler: Pointer to handler
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_ResetStats(TM1629_Handler_t *Handler)
+{
+  memset(&Handler->Stats, 0, sizeof(TM1629_Stats_t));
+  return TM1629_OK;
+}
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_BUS)
+/**
+ * @brief  Initialize shared bus
+ * @param  Bus: Pointer to bus
+ * @note   Context and WriteSTBMask are not touched.
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_Bus_Init(TM1629_Bus_t *Bus)
+{
+  Bus->NumOfHandlers = 0;
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+  Bus->DirDIO = DIR_DIO_UNKNOWN;
+#endif
+
+  return TM1629_OK;
+}
+
+
+/**
+ * @brief  Attach handler to shared bus
+ * @param  Bus: Pointer to bus
+ * @param  Handler: Pointer to handler
+ * @param  Index: Pointer to save index of the handler on the bus (bit of the
+ *                handler in masks). It can be NULL.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ *         - TM1629_FAIL: Bus is full.
+ */
+TM1629_Result_t
+TM1629_Bus_Attach(TM1629_Bus_t *Bus, TM1629_Handler_t *Handler, uint8_t *Index)
+{
+  if (Bus->NumOfHandlers >= TM1629_CONFIG_BUS_MAX_HANDLERS)
+    return TM1629_FAIL;
+
+  if (Index)
+    *Index = Bus->NumOfHandlers;
+
+  Bus->Handlers[Bus->NumOfHandlers++] = Handler;
+  Handler->Bus = Bus;
+
+  return TM1629_OK;
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Initialize wide bus
+ * @param  Bus: Pointer to wide bus
+ * @note   Platform functions, Context and CLKMask must be set before.
+ * @note   Timing is loaded with the default profile and can be changed
+ *         afterwards.
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ *         - TM1629_FAIL: Needed platform functions are not linked.
+ */
+TM1629_Result_t
+TM1629_WideBus_Init(TM1629_WideBus_t *Bus)
+{
+  if (!Bus->WriteSTB || !Bus->DirPort || !Bus->WritePort || !Bus->ReadPort)
+    return TM1629_FAIL;
+
+  if (!Bus->CLKMask && !Bus->WriteCLK)
+    return TM1629_FAIL;
+
+  if (!Bus->DelayUs && !Bus->DelayNs)
+    return TM1629_FAIL;
+
+  Bus->NumOfHandlers = 0;
+  Bus->PortMask = 0;
+  Bus->DirDIO = DIR_DIO_UNKNOWN;
+
+  Bus->Timing.ClockHighNs = TM1629_TIMING_DEFAULT_CLOCK_HIGH_NS;
+  Bus->Timing.ClockLowNs = TM1629_TIMING_DEFAULT_CLOCK_LOW_NS;
+  Bus->Timing.TurnaroundNs = TM1629_TIMING_DEFAULT_TURNAROUND_NS;
+  Bus->Timing.ByteGapNs = TM1629_TIMING_DEFAULT_BYTE_GAP_NS;
+  Bus->Timing.StrobeNs = TM1629_TIMING_DEFAULT_STROBE_NS;
+
+  Bus->WriteSTB(Bus->Context, 1);
+
+  return TM1629_OK;
+}
+
+
+/**
+ * @brief  Attach handler to wide bus
+ * @param  Bus: Pointer to wide bus
+ * @param  Handler: Pointer to handler. It must be initialized by TM1629_Init.
+ * @param  DIOMask: DIO pin of the chip on the port (one bit)
+ * @param  Index: Pointer to save index of the handler on the bus. It can be
+ *                NULL.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ *         - TM1629_FAIL: Bus is full or DIOMask is invalid.
+ */
+TM1629_Result_t
+TM1629_WideBus_Attach(TM1629_WideBus_t *Bus, TM1629_Handler_t *Handler,
+                      uint32_t DIOMask, uint8_t *Index)
+{
+  if (Bus->NumOfHandlers >= TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS)
+    return TM1629_FAIL;
+
+  // Exactly one pin, not used by another chip or by CLK
+  if (!DIOMask || (DIOMask & (DIOMask - 1)) ||
+      (DIOMask & (Bus->PortMask | Bus->CLKMask)))
+    return TM1629_FAIL;
+
+  if (Index)
+    *Index = Bus->NumOfHandlers;
+
+  Bus->Handlers[Bus->NumOfHandlers] = Handler;
+  Bus->DIOMask[Bus->NumOfHandlers] = DIOMask;
+  Bus->NumOfHandlers++;
+  Bus->PortMask |= DIOMask;
+  Bus->DirDIO = DIR_DIO_UNKNOWN;
+
+  return TM1629_OK;
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+/**
+ * @brief  Set bus timing profile of GPIO communication
+ * @param  Handler: Pointer to handler
+ * @param  Timing: Pointer to timing profile
+ * @note   TM1629_Init loads the default profile, so this function must be
+ *         called after TM1629_Init.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_SetTiming(TM1629_Handler_t *Handler, const TM1629_Timing_t *Timing)
+{
+  Handler->Timing = *Timing;
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+  Handler->WaveformBytes = 0;
+#endif
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+  if (Handler->Calibration.Valid)
+    TM1629_CalibrateLoops(Handler);
+#endif
+  return TM1629_OK;
+}
+
+
+/**
+ * @brief  Get number of DIO direction switches avoided by direction caching
+ * @param  Handler: Pointer to handler
+ * @param  Count: Pointer to save the number of avoided switches
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_GetDirDIOSkipped(TM1629_Handler_t *Handler, uint32_t *Count)
+{
+  *Count = Handler->DirDIOSkipped;
+  return TM1629_OK;
+}
+
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+/**
+ * @brief  Measure the cost of pin write calls and of the busy-wait loop, and
+ *         replace the delays of the timing profile with the smallest loop
+ *         counts that still meet it
+ * @param  Handler: Pointer to handler
+ * @note   TM1629_Init calls this function when GetTimeNs is linked. Call it
+ *         again if the CPU clock changes.
+ * @note   CLK is held high and STB is not touched, so the chip ignores the
+ *         measurement.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ *         - TM1629_FAIL: GetTimeNs is not linked, the clock does not advance or an
+ *                        asynchronous flush is in progress.
+ */
+TM1629_Result_t
+TM1629_Calibrate(TM1629_Handler_t *Handler)
+{
+  uint32_t PinWrite = 0xFFFFFFFF;
+  uint32_t Loop = 0xFFFFFFFF;
+  uint32_t Cost = 0;
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_Async_PinsBusy(Handler))
+    return TM1629_FAIL;
+#endif
+
+  Handler->Calibration.Valid = 0;
+  if (!TM1629_CHECK_PLATFORM_GET_TIME_NS(Handler))
+    return TM1629_FAIL;
+
+  // The fastest run is kept, so the delays stay long enough if the CPU runs
+  // faster later
+  for (uint8_t i = 0; i < CALIBRATION_RUNS; i++)
+  {
+    Cost = TM1629_CalibrationMeasure(Handler, 0);
+    if (Cost < PinWrite)
+      PinWrite = Cost;
+
+    Cost = TM1629_CalibrationMeasure(Handler, 1);
+    if (Cost < Loop)
+      Loop = Cost;
+  }
+
+  if (!Loop)
+    return TM1629_FAIL;
+
+  Handler->Calibration.PinWriteNs = (PinWrite / 16 > 0xFFFF) ? 0xFFFF : (uint16_t)(PinWrite / 16);
+  Handler->Calibration.LoopCost = (Loop > 0xFFFF) ? 0xFFFF : (uint16_t)Loop;
+
+  TM1629_CalibrateLoops(Handler);
+  Handler->Calibration.Valid = 1;
+
+  return TM1629_OK;
+}
+#endif
+#endif
+
+
+
+/**
+ ==================================================================================
+                        ##### Public Display Functions #####                       
+ ==================================================================================
+ */
+
+/**
+ * @brief  Config display parameters
+ * @param  Handler: Pointer to handler
+ * @param  Brightness: Set brightness level
+ *         - 0: Display pulse width is set as 1/16
+ *         - 1: Display pulse width is set as 2/16
+ *         - 2: Display pulse width is set as 4/16
+ *         - 3: Display pulse width is set as 10/16
+ *         - 4: Display pulse width is set as 11/16
+ *         - 5: Display pulse width is set as 12/16
+ *         - 6: Display pulse width is set as 13/16
+ *         - 7: Display pulse width is set as 14/16
+ * 
+ * @param  DisplayState: Set display ON or OFF
+ *         - TM1629_DISPLAY_STATE_OFF: Set display state OFF
+ *         - TM1629_DISPLAY_STATE_ON: Set display state ON
+ * 
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: An asynchronous flush is in progress
+ */
+TM1629_Result_t
+TM1629_ConfigDisplay(TM1629_Handler_t *Handler,
+                     uint8_t Brightness, uint8_t DisplayState)
+{
+  uint8_t Data = COMMAND_DISPLAY_CONTROL;
+  Data |= (Brightness & 0x07);
+  Data |= (DisplayState != TM1629_DISPLAY_STATE_OFF) ? (COMMAND_DC_DISPLAY_IS_ON) : (COMMAND_DC_DISPLAY_IS_OFF);
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_Async_PinsBusy(Handler))
+    return TM1629_FAIL;
+#endif
+
+  if (Handler->DisplayControl == Data)
+  {
+    TM1629_STATS_ADD(Handler, CommandsSuppressed, 1);
+    return TM1629_OK;
+  }
+
+  Handler->DisplayControl =
+    (TM1629_WriteFrame(Handler, TM1629_TRACE_KIND_DISPLAY_CONTROL, &Data, 1) >= 0) ? Data : 0;
+
+  return TM1629_OK;
+}
+
+
+/**
+ * @brief  Set data to single digit in 7-segment format
+ * @param  Handler: Pointer to handler
+ * @param  DigitData: Digit data
+ * @param  DigitPos: Digit position
+ *         - 0: Seg1
+ *         - 1: Seg2
+ *         - .
+ *         - .
+ *         - .
+ * 
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ */
+TM1629_Result_t
+TM1629_SetSingleDigit(TM1629_Handler_t *Handler,
+                      uint8_t DigitData, uint8_t DigitPos)
+{
+  return TM1629_SetMultipleDigit(Handler, &DigitData, DigitPos, 1);
+}
+
+
+/**
+ * @brief  Set data to multiple digits in 7-segment format
+ * @param  Handler: Pointer to handler
+ * @param  DigitData: Array to Digits data
+ * @param  StartAddr: First digit position
+ *         - 0: Seg1
+ *         - 1: Seg2
+ *         - .
+ *         - .
+ *         - .
+ * 
+ * @param  Count: Number of segments to write data
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ */
+TM1629_Result_t
+TM1629_SetMultipleDigit(TM1629_Handler_t *Handler, const uint8_t *DigitData,
+                        uint8_t StartAddr, uint8_t Count)
+{
+#if (TM1629_CONFIG_SUPPORT_COM_ANODE)
+  uint8_t Matrix[8];
+  uint8_t First = 0;
+  uint8_t Last = 0;
+#endif
+
+  if (StartAddr >= 16)
+    return TM1629_FAIL;
+  if (Count > 16 - StartAddr)
+    Count = 16 - StartAddr;
+
+  if (Handler->DisplayType == TM1629_DISPLAY_TYPE_COM_CATHODE)
+  {
+#if (TM1629_SUPPORT_SHADOW)
+    for (uint8_t j = 0; j < Count; j++)
+    {
+      uint8_t Addr = StartAddr + j;
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+      // In buffered mode, unchanged bytes are not sent again
+      if (Handler->Buffered && Handler->DisplayRegister[Addr] == DigitData[j])
+        continue;
+#endif
+
+      Handler->DisplayRegister[Addr] = DigitData[j];
+      Handler->DirtyMask |= (1u << Addr);
+    }
+#else
+    if (TM1629_SetMultipleDisplayRegister(Handler, DigitData, StartAddr, Count) < 0)
+      return TM1629_FAIL;
+#endif
+  }
+#if (TM1629_CONFIG_SUPPORT_COM_ANODE)
+  else if (Count)
+  {
+    // Even registers hold SEG1..SEG8, odd registers hold SEG9..SEG16. Bit n of
+    // register (2 * k) is bit k of digit n, so each half is an 8x8 transpose.
+    for (uint8_t h = StartAddr / 8; h <= (StartAddr + Count - 1) / 8; h++)
+    {
+      for (uint8_t k = 0; k < 8; k++)
+        Matrix[k] = Handler->DisplayRegister[2 * k + h];
+
+      TM1629_Transpose8x8(Matrix);
+
+      First = (StartAddr > 8 * h) ? StartAddr : 8 * h;
+      Last = (StartAddr + Count < 8 * h + 8) ? StartAddr + Count : 8 * h + 8;
+      for (uint8_t p = First; p < Last; p++)
+        Matrix[p - 8 * h] = DigitData[p - StartAddr];
+
+      TM1629_Transpose8x8(Matrix);
+
+      for (uint8_t k = 0; k < 8; k++)
+      {
+        if (Handler->DisplayRegister[2 * k + h] == Matrix[k])
+          continue;
+
+        Handler->DisplayRegister[2 * k + h] = Matrix[k];
+        Handler->DirtyMask |= (1u << (2 * k + h));
+      }
+    }
+  }
+#endif
+
+#if (TM1629_SUPPORT_SHADOW)
+  if (TM1629_UpdateDisplayRegister(Handler) < 0)
+    return TM1629_FAIL;
+#endif
+
+  return TM1629_OK;
+}
+
+
+/**
+ * @brief  Set data to single digit in hexadecimal format
+ * @param  Handler: Pointer to handler
+ * @param  DigitData: Digit data (0, 1, ... , 15, a, A, b, B, ... , f, F) 
+ * @param  DigitPos: Digit position
+ *         - 0: Seg1
+ *         - 1: Seg2
+ *         - .
+ *         - .
+ *         - .
+ * 
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ */
+TM1629_Result_t
+TM1629_SetSingleDigit_HEX(TM1629_Handler_t *Handler,
+                          uint8_t DigitData, uint8_t DigitPos)
+{
+  uint8_t DigitDataOut = 0;
+  TM1629_HexTo7Seg((const uint8_t *)&DigitData, &DigitDataOut, 1);
+  return TM1629_SetSingleDigit(Handler, DigitDataOut, DigitPos);
+}
+
+
+/**
+ * @brief  Set data to multiple digits in hexadecimal format
+ * @param  Handler: Pointer to handler
+ * @param  DigitData: Array to Digits data. 
+ *                    (0, 1, ... , 15, a, A, b, B, ... , f, F)
+ * 
+ * @param  StartAddr: First digit position
+ *         - 0: Seg1
+ *         - 1: Seg2
+ *         - .
+ *         - .
+ *         - .
+ * 
+ * @param  Count: Number of segments to write data
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ */
+TM1629_Result_t
+TM1629_SetMultipleDigit_HEX(TM1629_Handler_t *Handler, const uint8_t *DigitData,
+                            uint8_t StartAddr, uint8_t Count)
+{
+  uint8_t DigitDataOut[16];
+
+  if (Count > 16)
+    Count = 16;
+
+  TM1629_HexTo7Seg(DigitData, DigitDataOut, Count);
+  return TM1629_SetMultipleDigit(Handler,
+                                 (const uint8_t *)DigitDataOut, StartAddr, Count);
+}
+
+
+/**
+ * @brief  Set data to single digit in char format
+ * @param  Handler: Pointer to handler
+ * @param  Char: Character to display
+ *               Supported chars 0,1,2,3,4,5,6,7,8,9
+ *                               A,b,C,d,E,F,g,G,h,H,i,I,j,l,L,n,N,o,O,P,q,r,S,
+ *                               t,u,U,y,_,-,Overscore (use ~ to set)
+ * @param  DigitPos: Digit position
+ *         - 0: Seg1
+ *         - 1: Seg2
+ *         - .
+ *         - .
+ *         - .
+ * 
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ */
+TM1629_Result_t
+TM1629_SetSingleDigit_CHAR(TM1629_Handler_t *Handler,
+                           char Char, uint8_t DigitPos)
+{
+  uint8_t DigitData = 0;
+  TM1629_StringTo7Seg(&Char, &DigitData, 1);
+  return TM1629_SetSingleDigit(Handler, DigitData, DigitPos);
+}
+
+/**
+ * @brief  Set data to multiple digits in char format
+ * @param  Handler: Pointer to handler
+ * @param  Str: String of characters
+ *              Supported chars 0,1,2,3,4,5,6,7,8,9
+ *                              A,b,C,d,E,F,g,G,h,H,i,I,j,l,L,n,N,o,O,P,q,r,S,
+ *                              t,u,U,y,_,-,Overscore (use ~ to set)
+ * 
+ * @param  StartAddr: First digit position
+ *         - 0: Seg1
+ *         - 1: Seg2
+ *         - .
+ *         - .
+ *         - .
  * 
+ * @param  Count: Number of segments to write data
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ */
+TM1629_Result_t
+TM1629_SetMultipleDigit_CHAR(TM1629_Handler_t *Handler, const char *Str,
+                             uint8_t StartAddr, uint8_t Count)
+{
+  uint8_t DigitData[16];
+
+  if (Count > 16)
+    Count = 16;
+
+  TM1629_StringTo7Seg(Str, DigitData, Count);
+  return TM1629_SetMultipleDigit(Handler,
+                                 (const uint8_t *)DigitData, StartAddr, Count);
+}
+
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+/**
+ * @brief  Enable or disable buffered mode
+ * @param  Handler: Pointer to handler
+ * @param  Enable: Buffered mode state
+ *         - 0: Display functions send data to the chip immediately
+ *         - 1: Display functions only update the shadow of display RAM and the
+ *              changes are sent by TM1629_Flush
+ * @note   Disabling buffered mode flushes the pending changes.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to flush the pending changes
+ */
+TM1629_Result_t
+TM1629_SetBufferedMode(TM1629_Handler_t *Handler, uint8_t Enable)
+{
+  Handler->Buffered = Enable ? 1 : 0;
+
+  if (!Handler->Buffered)
+    return TM1629_Flush(Handler);
+
+  return TM1629_OK;
+}
+
+
+/**
+ * @brief  Send changed bytes of the shadow of display RAM to the chip
+ * @param  Handler: Pointer to handler
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data
+ */
+TM1629_Result_t
+TM1629_Flush(TM1629_Handler_t *Handler)
+{
+  if (TM1629_FlushDisplayRegister(Handler) < 0)
+    return TM1629_FAIL;
+
+  return TM1629_OK;
+}
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+/**
+ * @brief  Queue changed bytes of the shadow of display RAM and return without
+ *         sending them
+ * @param  Handler: Pointer to handler
+ * @note   The queued bytes are copied, so the shadow can be changed while the
+ *         flush is in progress. TM1629_Poll sends them and calls the
+ *         completion callback at the end. Nothing is queued (and the callback
+ *         is not called) if no byte is changed.
+ * @note   While the flush is in progress (TM1629_ASYNC_IS_BUSY), other
+ *         functions that communicate with the chip, or with another chip
+ *         attached to the same shared bus, return TM1629_FAIL and display
+ *         functions only update the shadow.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Another flush is in progress (also on the bus) or the
+ *                        handler does not use GPIO communication
+ */
+TM1629_Result_t
+TM1629_FlushAsync(TM1629_Handler_t *Handler)
+{
+  TM1629_Async_t *Async = &Handler->Async;
+  TM1629_FlushPlan_t Plan;
+  uint8_t Addr = 0;
+  uint8_t Index = 0;
+
+  if (TM1629_Async_PinsBusy(Handler) || !TM1629_IS_COMMUNICATION_GPIO(Handler))
+    return TM1629_FAIL;
+
+  if (!Handler->DirtyMask)
+    return TM1629_OK;
+
+  TM1629_PlanFlush(Handler, &Plan);
+  Async->NumOfFrames = 0;
+
+  if (Plan.SendDataCommand)
+  {
+    Async->Bytes[Index++] = Plan.DataCommand;
+    Async->Lengths[Async->NumOfFrames++] = 1;
+    Handler->DataCommand = Plan.DataCommand;
+  }
+  else
+  {
+    TM1629_STATS_ADD(Handler, CommandsSuppressed, 1);
+  }
+
+  for (uint8_t i = 0; i < Plan.NumOfWrites; i++)
+  {
+    Addr = Plan.Writes[i].Addr;
+
+    Async->Bytes[Index++] = COMMAND_ADDRESS_SETTING | Addr;
+    for (uint8_t j = 0; j < Plan.Writes[i].Count; j++, Addr++)
+    {
+      Async->Bytes[Index++] = Handler->DisplayRegister[Addr];
+      Handler->DirtyMask &= ~(1u << Addr);
+    }
+    Async->Lengths[Async->NumOfFrames++] = Plan.Writes[i].Count + 1;
+  }
+
+  Async->Frame = 0;
+  Async->Index = 0;
+  Async->Sent = 0;
+  Async->Edge = 0;
+  Async->Started = 0;
+  Async->Busy = 1;
+
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+  Async->Timer = 0;
+  if (TM1629_CHECK_PLATFORM_TIMER(Handler))
+  {
+    Async->Timer = 1;
+    if (!TM1629_CHECK_RES_PLATFORM(TM1629_TIMER_START(Handler, TM1629_Async_TickNs(Handler))))
+    {
+      // Nothing is sent, the whole shadow goes with the next flush
+      Async->Timer = 0;
+      Async->Busy = 0;
+      Handler->DataCommand = 0;
+      Handler->DirtyMask = 0xFFFF;
+      return TM1629_FAIL;
+    }
+  }
+#endif
+
+  return TM1629_OK;
+}
+
+
+/**
+ * @brief  Advance asynchronous flush
+ * @param  Handler: Pointer to handler
+ * @param  MaxEdges: Most STB/CLK edges generated by this call. Each edge
+ *                   also waits for its delay of the timing profile, so the
+ *                   call takes about MaxEdges * 1 us with the default
+ *                   profile.
+ * @note   It does nothing while the flush is driven by the timer.
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful (also when idle)
+ *         - TM1629_FAIL: A platform function failed and the flush is aborted
+ */
+TM1629_Result_t
+TM1629_Poll(TM1629_Handler_t *Handler, uint16_t MaxEdges)
+{
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+  if (Handler->Async.Timer)
+    return TM1629_OK;
+#endif
+
+  for (; Handler->Async.Busy && MaxEdges; MaxEdges--)
+  {
+    if (TM1629_Async_Step(Handler, 1) < 0)
+      return TM1629_FAIL;
+  }
+
+  return TM1629_OK;
+}
+
+
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+/**
+ * @brief  Make the next edge of the flush started by TM1629_FlushAsync
+ * @param  Handler: Pointer to handler
+ * @note   Call it from the interrupt of the timer started by TimerStart. Each
+ *         call makes at most one STB or CLK edge without any delay, so the
+ *         timer period is the only timing. The period passed to TimerStart is
+ *         the largest of ClockHighNs, ClockLowNs and StrobeNs of the timing
+ *         profile.
+ * @note   The timer is stopped and the completion callback is called from
+ *         this function after the last edge.
+ * @retval None
+ */
+void
+TM1629_TimerTick(TM1629_Handler_t *Handler)
+{
+  if (!Handler->Async.Busy || !Handler->Async.Timer)
+    return;
+
+  TM1629_Async_Step(Handler, 0);
+}
+#endif
+#endif
+
+
+#if (TM1629_SUPPORT_SHADOW)
+/**
+ * @brief  Compute the cheapest sequence of transactions sending the dirty bytes
+ *         of the shadow of display RAM, without sending anything
+ * @param  Handler: Pointer to handler
+ * @param  Plan: Pointer to save the plan
+ * @note   Only auto-increment bursts are planned. A burst may cover clean
+ *         bytes between dirty ones when that is cheaper than starting another
+ *         transaction. A fixed address write costs the same as a burst of one
+ *         byte, so fixed address mode is never cheaper.
+ *
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
  */
 TM1629_Result_t
-TM1629_ConfigDisplay(TM1629_Handler_t *Handler,
-                     uint8_t Brightness, uint8_t DisplayState)
+TM1629_PlanFlush(const TM1629_Handler_t *Handler, TM1629_FlushPlan_t *Plan)
 {
-  uint8_t Data = COMMAND_DISPLAY_CONTROL;
-  Data |= (Brightness & 0x07);
-  Data |= (DisplayState != TM1629_DISPLAY_STATE_OFF) ? (COMMAND_DC_DISPLAY_IS_ON) : (COMMAND_DC_DISPLAY_IS_OFF);
+  const uint8_t AutoCommand = COMMAND_DATA_READING_WRITING_SETTING |
+                              COMMAND_DRWS_WRITE_DATA_TO_DISPLAY_REGISTER |
+                              COMMAND_DRWS_AUTO_INCREASE_OF_ADDRESS |
+                              COMMAND_DRWS_NORMAL_MODE;
+  const uint16_t CommandCost = TM1629_CONFIG_TRANSACTION_COST + 8;
+  uint8_t Dirty[16];
+  uint8_t NumOfDirty = 0;
+  uint16_t Best[17];
+  uint8_t From[17];
+  uint16_t Cost = 0;
+  uint8_t j = 0;
+
+  Plan->DataCommand = AutoCommand;
+  Plan->SendDataCommand = 0;
+  Plan->NumOfWrites = 0;
+  Plan->Cost = 0;
+
+  for (uint8_t i = 0; i < 16; i++)
+  {
+    if (Handler->DirtyMask & (1u << i))
+      Dirty[NumOfDirty++] = i;
+  }
+
+  if (!NumOfDirty)
+    return TM1629_OK;
+
+  // Best[n]: cheapest way to send first n dirty bytes using bursts, where a
+  // burst from Dirty[i] to Dirty[n-1] also resends the clean bytes between them
+  Best[0] = 0;
+  for (uint8_t n = 1; n <= NumOfDirty; n++)
+  {
+    Best[n] = 0xFFFF;
+    for (uint8_t i = 0; i < n; i++)
+    {
+      Cost = Best[i] + CommandCost + 8 * (Dirty[n - 1] - Dirty[i] + 1);
+      if (Cost < Best[n])
+      {
+        Best[n] = Cost;
+        From[n] = i;
+      }
+    }
+  }
 
-  TM1629_StartComunication(Handler);
-  TM1629_WriteBytes(Handler, &Data, 1);
-  TM1629_StopComunication(Handler);
+  Plan->SendDataCommand = (Handler->DataCommand != AutoCommand);
+  Plan->Cost = Best[NumOfDirty];
+  if (Plan->SendDataCommand)
+    Plan->Cost += CommandCost;
+
+  // Count the bursts and fill them from the last one
+  for (uint8_t n = NumOfDirty; n; n = From[n])
+    Plan->NumOfWrites++;
+
+  j = Plan->NumOfWrites;
+  for (uint8_t n = NumOfDirty; n; n = From[n])
+  {
+    j--;
+    Plan->Writes[j].Addr = Dirty[From[n]];
+    Plan->Writes[j].Count = Dirty[n - 1] - Dirty[From[n]] + 1;
+  }
 
   return TM1629_OK;
 }
+#endif
 
 
+#if (TM1629_CONFIG_SUPPORT_BUS)
 /**
- * @brief  Set data to single digit in 7-segment format
- * @param  Handler: Pointer to handler
- * @param  DigitData: Digit data
- * @param  DigitPos: Digit position
- *         - 0: Seg1
- *         - 1: Seg2
- *         - .
- *         - .
- *         - .
- * 
+ * @brief  Config display parameters of several chips in one transaction
+ * @param  Bus: Pointer to bus
+ * @param  Mask: Selected chips (bit n => n-th handler attached to the bus)
+ * @param  Brightness: Set brightness level (see TM1629_ConfigDisplay)
+ * @param  DisplayState: Set display ON or OFF (see TM1629_ConfigDisplay)
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data or an asynchronous flush is in
+ *           progress
  */
 TM1629_Result_t
-TM1629_SetSingleDigit(TM1629_Handler_t *Handler,
-                      uint8_t DigitData, uint8_t DigitPos)
-{ 
-  if (Handler->DisplayType == TM1629_DISPLAY_TYPE_COM_CATHODE)
-    TM1629_SetMultipleDisplayRegister(Handler, &DigitData, DigitPos, 1);
-#if (TM1629_CONFIG_SUPPORT_COM_ANODE)
-  else
-    TM1629_SetMultipleDigit(Handler, &DigitData, DigitPos, 1);
+TM1629_Bus_ConfigDisplay(TM1629_Bus_t *Bus, uint32_t Mask,
+                         uint8_t Brightness, uint8_t DisplayState)
+{
+  uint8_t Data = COMMAND_DISPLAY_CONTROL;
+  int8_t Result = 0;
+
+  Data |= (Brightness & 0x07);
+  Data |= (DisplayState != TM1629_DISPLAY_STATE_OFF) ? (COMMAND_DC_DISPLAY_IS_ON) : (COMMAND_DC_DISPLAY_IS_OFF);
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_Bus_Busy(Bus))
+    return TM1629_FAIL;
 #endif
-  return TM1629_OK;
+
+  // Chips already in the requested state are not selected
+  Mask = TM1629_Bus_ValidMask(Bus, Mask);
+  for (uint8_t i = 0; i < Bus->NumOfHandlers; i++)
+  {
+    if (Bus->Handlers[i]->DisplayControl == Data)
+      Mask &= ~(1ul << i);
+  }
+
+  if (!Mask)
+    return TM1629_OK;
+
+  Result = TM1629_Bus_WriteBytes(Bus, Mask, TM1629_TRACE_KIND_DISPLAY_CONTROL,
+                                 &Data, 1);
+
+  for (uint8_t i = 0; i < Bus->NumOfHandlers; i++)
+  {
+    if (Mask & (1ul << i))
+      Bus->Handlers[i]->DisplayControl = (Result >= 0) ? Data : 0;
+  }
+
+  return (Result >= 0) ? TM1629_OK : TM1629_FAIL;
 }
 
 
 /**
- * @brief  Set data to multiple digits in 7-segment format
- * @param  Handler: Pointer to handler
- * @param  DigitData: Array to Digits data
- * @param  StartAddr: First digit position
- *         - 0: Seg1
- *         - 1: Seg2
- *         - .
- *         - .
- *         - .
- * 
- * @param  Count: Number of segments to write data
+ * @brief  Clear whole display RAM of several chips in one transaction
+ * @param  Bus: Pointer to bus
+ * @param  Mask: Selected chips (bit n => n-th handler attached to the bus)
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data or an asynchronous flush is in
+ *           progress
  */
 TM1629_Result_t
-TM1629_SetMultipleDigit(TM1629_Handler_t *Handler, const uint8_t *DigitData,
-                        uint8_t StartAddr, uint8_t Count)
+TM1629_Bus_Clear(TM1629_Bus_t *Bus, uint32_t Mask)
 {
-  uint8_t Shift = 0;
-  uint8_t DigitDataBuff = 0;
-  uint8_t i = 0;
+  uint8_t Data = COMMAND_DATA_READING_WRITING_SETTING |
+                 COMMAND_DRWS_WRITE_DATA_TO_DISPLAY_REGISTER |
+                 COMMAND_DRWS_AUTO_INCREASE_OF_ADDRESS |
+                 COMMAND_DRWS_NORMAL_MODE;
+  uint8_t Frame[TM1629_FRAME_SIZE] = {0};
+  uint32_t CommandMask = 0;
+  int8_t Result = 0;
 
-  if (Handler->DisplayType == TM1629_DISPLAY_TYPE_COM_CATHODE)
-    TM1629_SetMultipleDisplayRegister(Handler, DigitData, StartAddr, Count);
-#if (TM1629_CONFIG_SUPPORT_COM_ANODE)
-  else
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_Bus_Busy(Bus))
+    return TM1629_FAIL;
+#endif
+
+  Mask = TM1629_Bus_ValidMask(Bus, Mask);
+  for (uint8_t i = 0; i < Bus->NumOfHandlers; i++)
   {
-    for (uint8_t j = 0; j < Count; j++)
+    if ((Mask & (1ul << i)) && Bus->Handlers[i]->DataCommand != Data)
+      CommandMask |= (1ul << i);
+  }
+
+  if (CommandMask)
+  {
+    Result = TM1629_Bus_WriteBytes(Bus, CommandMask,
+                                   TM1629_TRACE_KIND_DATA_COMMAND, &Data, 1);
+    for (uint8_t i = 0; i < Bus->NumOfHandlers; i++)
     {
-      DigitDataBuff = DigitData[j];
+      if (CommandMask & (1ul << i))
+        Bus->Handlers[i]->DataCommand = (Result >= 0) ? Data : 0;
+    }
 
-      if ((j + StartAddr) >= 0 && (j + StartAddr) <= 7)
-      {
-        Shift = j + StartAddr;
-        i = 0;
-      }
-      else
-      {
-        Shift = (j + StartAddr) - 8;
-        i = 1;
-      }
+    if (Result < 0)
+      return TM1629_FAIL;
+  }
 
-      for (; i < 16; i += 2, DigitDataBuff >>= 1)
-      {
-        if (DigitDataBuff & 0x01)
-          Handler->DisplayRegister[i] |= (1 << Shift);
-        else
-          Handler->DisplayRegister[i] &= ~(1 << Shift);
-      }
-    }
-    TM1629_SetMultipleDisplayRegister(Handler, Handler->DisplayRegister, 0, 16);
+  Frame[0] = COMMAND_ADDRESS_SETTING | 0;
+  if (TM1629_Bus_WriteBytes(Bus, Mask, TM1629_TRACE_KIND_WRITE_DISPLAY,
+                            Frame, TM1629_FRAME_SIZE) < 0)
+    return TM1629_FAIL;
+
+#if (TM1629_SUPPORT_SHADOW)
+  for (uint8_t i = 0; i < Bus->NumOfHandlers; i++)
+  {
+    if (!(Mask & (1ul << i)))
+      continue;
+
+    for (uint8_t j = 0; j < 16; j++)
+      Bus->Handlers[i]->DisplayRegister[j] = 0;
+    Bus->Handlers[i]->DirtyMask = 0;
   }
 #endif
 
   return TM1629_OK;
 }
+#endif
 
-
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
 /**
- * @brief  Set data to single digit in hexadecimal format
- * @param  Handler: Pointer to handler
- * @param  DigitData: Digit data (0, 1, ... , 15, a, A, b, B, ... , f, F) 
- * @param  DigitPos: Digit position
- *         - 0: Seg1
- *         - 1: Seg2
- *         - .
- *         - .
- *         - .
- * 
+ * @brief  Config display parameters of all chips on the wide bus
+ * @param  Bus: Pointer to wide bus
+ * @param  Brightness: Set brightness level (see TM1629_ConfigDisplay)
+ * @param  DisplayState: Set display ON or OFF (see TM1629_ConfigDisplay)
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data or an asynchronous flush is in
+ *           progress
  */
 TM1629_Result_t
-TM1629_SetSingleDigit_HEX(TM1629_Handler_t *Handler,
-                          uint8_t DigitData, uint8_t DigitPos)
+TM1629_WideBus_ConfigDisplay(TM1629_WideBus_t *Bus,
+                             uint8_t Brightness, uint8_t DisplayState)
 {
-  uint8_t DigitDataOut = 0;
-  TM1629_HexTo7Seg((const uint8_t *)&DigitData, &DigitDataOut, 1);
-  return TM1629_SetSingleDigit(Handler, DigitDataOut, DigitPos);
+  uint8_t Data = COMMAND_DISPLAY_CONTROL;
+  uint8_t Changed = 0;
+  int8_t Result = 0;
+
+  Data |= (Brightness & 0x07);
+  Data |= (DisplayState != TM1629_DISPLAY_STATE_OFF) ? (COMMAND_DC_DISPLAY_IS_ON) : (COMMAND_DC_DISPLAY_IS_OFF);
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_WideBus_Busy(Bus))
+    return TM1629_FAIL;
+#endif
+
+  // Chips that are already configured receive the same byte again; it costs
+  // no extra bus time
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+    Changed |= (Bus->Handlers[n]->DisplayControl != Data);
+
+  if (!Changed)
+    return TM1629_OK;
+
+  TM1629_WideBus_StartCommunication(Bus);
+  Result = TM1629_WideBus_WriteCommand(Bus, Data);
+  TM1629_WideBus_StopCommunication(Bus);
+
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+    Bus->Handlers[n]->DisplayControl = (Result >= 0) ? Data : 0;
+
+  return (Result >= 0) ? TM1629_OK : TM1629_FAIL;
 }
 
 
 /**
- * @brief  Set data to multiple digits in hexadecimal format
- * @param  Handler: Pointer to handler
- * @param  DigitData: Array to Digits data. 
- *                    (0, 1, ... , 15, a, A, b, B, ... , f, F)
- * 
- * @param  StartAddr: First digit position
- *         - 0: Seg1
- *         - 1: Seg2
- *         - .
- *         - .
- *         - .
- * 
- * @param  Count: Number of segments to write data
+ * @brief  Send display RAM shadow of all chips on the wide bus in parallel
+ * @note   The address range covering the dirty bytes of all chips is sent
+ *         in one transaction.
+ * @param  Bus: Pointer to wide bus
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data or an asynchronous flush is in
+ *           progress
  */
 TM1629_Result_t
-TM1629_SetMultipleDigit_HEX(TM1629_Handler_t *Handler, const uint8_t *DigitData,
-                            uint8_t StartAddr, uint8_t Count)
+TM1629_WideBus_Flush(TM1629_WideBus_t *Bus)
 {
-  uint8_t DigitDataOut[16];
+  const uint8_t *Data[TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS];
+  uint8_t Command = COMMAND_DATA_READING_WRITING_SETTING |
+                    COMMAND_DRWS_WRITE_DATA_TO_DISPLAY_REGISTER |
+                    COMMAND_DRWS_AUTO_INCREASE_OF_ADDRESS |
+                    COMMAND_DRWS_NORMAL_MODE;
+  uint16_t DirtyMask = 0;
+  uint8_t SendCommand = 0;
+  uint8_t First = 0;
+  uint8_t Last = 15;
+  int8_t Result = 0;
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_WideBus_Busy(Bus))
+    return TM1629_FAIL;
+#endif
 
-  if (Count > 16)
-    Count = 16;
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+  {
+    DirtyMask |= Bus->Handlers[n]->DirtyMask;
+    SendCommand |= (Bus->Handlers[n]->DataCommand != Command);
+  }
 
-  TM1629_HexTo7Seg(DigitData, DigitDataOut, Count);
-  return TM1629_SetMultipleDigit(Handler,
-                                 (const uint8_t *)DigitDataOut, StartAddr, Count);
+  if (!DirtyMask)
+    return TM1629_OK;
+
+  while (!(DirtyMask & (1u << First)))
+    First++;
+  while (!(DirtyMask & (1u << Last)))
+    Last--;
+
+  if (SendCommand)
+  {
+    TM1629_WideBus_StartCommunication(Bus);
+    Result = TM1629_WideBus_WriteCommand(Bus, Command);
+    TM1629_WideBus_StopCommunication(Bus);
+
+    for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+      Bus->Handlers[n]->DataCommand = (Result >= 0) ? Command : 0;
+
+    if (Result < 0)
+      return TM1629_FAIL;
+  }
+
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+    Data[n] = &Bus->Handlers[n]->DisplayRegister[First];
+
+  TM1629_WideBus_StartCommunication(Bus);
+  Result = TM1629_WideBus_WriteCommand(Bus, COMMAND_ADDRESS_SETTING | First);
+  if (Result >= 0)
+    Result = TM1629_WideBus_WriteBytes(Bus, Data, Last - First + 1);
+  TM1629_WideBus_StopCommunication(Bus);
+
+  if (Result < 0)
+    return TM1629_FAIL;
+
+  for (uint8_t n = 0; n < Bus->NumOfHandlers; n++)
+    Bus->Handlers[n]->DirtyMask = 0;
+
+  return TM1629_OK;
 }
+#endif
 
 
 /**
- * @brief  Set data to single digit in char format
- * @param  Handler: Pointer to handler
- * @param  Char: Character to display
- *               Supported chars 0,1,2,3,4,5,6,7,8,9
- *                               A,b,C,d,E,F,g,G,h,H,i,I,j,l,L,n,N,o,O,P,q,r,S,
- *                               t,u,U,y,_,-,Overscore (use ~ to set)
- * @param  DigitPos: Digit position
- *         - 0: Seg1
- *         - 1: Seg2
- *         - .
- *         - .
- *         - .
- * 
+ ==================================================================================
+                       ##### Public Conversion Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Convert hexadecimal digits to 7-segment format
+ * @param  Hex: Array of digits (0, 1, ... , 15, a, A, b, B, ... , f, F). Set
+ *              'TM1629_DECIMAL_POINT' bit of a digit to turn its DP on.
+ * @param  Data: Array to save 7-segment codes (unsupported digits => 0)
+ * @param  Count: Number of digits to convert
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Invalid arguments
  */
 TM1629_Result_t
-TM1629_SetSingleDigit_CHAR(TM1629_Handler_t *Handler,
-                           char Char, uint8_t DigitPos)
+TM1629_HexTo7Seg(const uint8_t *Hex, uint8_t *Data, uint8_t Count)
 {
-  uint8_t DigitData = 0;
-  TM1629_StringTo7Seg((const char *)&DigitData, &DigitData, 1);
-  return TM1629_SetSingleDigit(Handler, DigitData, DigitPos);
+  if (!Hex || !Data)
+    return TM1629_FAIL;
+
+  TM1629_LookupTo7Seg(HexTo7Seg, Hex, Data, Count);
+  return TM1629_OK;
 }
 
+
 /**
- * @brief  Set data to multiple digits in char format
- * @param  Handler: Pointer to handler
- * @param  Str: String of characters
+ * @brief  Convert characters to 7-segment format
+ * @param  Str: Array of characters
  *              Supported chars 0,1,2,3,4,5,6,7,8,9
  *                              A,b,C,d,E,F,g,G,h,H,i,I,j,l,L,n,N,o,O,P,q,r,S,
- *                              t,u,U,y,_,-,Overscore (use ~ to set)
- * 
- * @param  StartAddr: First digit position
- *         - 0: Seg1
- *         - 1: Seg2
- *         - .
- *         - .
- *         - .
- * 
- * @param  Count: Number of segments to write data
+ *                              t,u,U,y,_,-,Overscore (use ~ to set),
+ *                              . (only decimal point)
+ *              Set 'TM1629_DECIMAL_POINT' bit of a char to turn its DP on.
+ * @param  Data: Array to save 7-segment codes (unsupported chars => 0)
+ * @param  Count: Number of characters to convert
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Invalid arguments
  */
 TM1629_Result_t
-TM1629_SetMultipleDigit_CHAR(TM1629_Handler_t *Handler, const char *Str,
-                             uint8_t StartAddr, uint8_t Count)
+TM1629_StringTo7Seg(const char *Str, uint8_t *Data, uint8_t Count)
 {
-  uint8_t DigitData[16];
-
-  if (Count > 16)
-    Count = 16;
+  if (!Str || !Data)
+    return TM1629_FAIL;
 
-  TM1629_StringTo7Seg(Str, DigitData, Count);
-  return TM1629_SetMultipleDigit(Handler,
-                                 (const uint8_t *)DigitData, StartAddr, Count);
+  TM1629_LookupTo7Seg(CharTo7Seg, (const uint8_t *)Str, Data, Count);
+  return TM1629_OK;
 }
 
 
@@ -881,35 +2860,64 @@ TM1629_SetMultipleDigit_CHAR(TM1629_Handler_t *Handler, const char *Str,
  * 
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: An asynchronous flush is in progress
  */
 TM1629_Result_t
 TM1629_ScanKeys(TM1629_Handler_t *Handler, uint32_t *Keys)
 {
   uint8_t KeyRegs[4];
-  uint32_t KeysBuff = 0;
-  uint8_t Kn = 0x01;
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_Async_PinsBusy(Handler))
+    return TM1629_FAIL;
+#endif
 
   TM1629_ScanKeyRegs(Handler, KeyRegs);
+  *Keys = TM1629_DecodeKeys(KeyRegs);
 
-  for (uint8_t i = 0; i < 4; i++)
-  {
-    for (int8_t j = 3; j >= 0; j--)
-    {
-      KeysBuff <<= 1;
+  return TM1629_OK;
+}
 
-      if (KeyRegs[j] & (Kn << 4))
-        KeysBuff |= 1;
 
-      KeysBuff <<= 1;
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Scan keys of all chips on the wide bus in parallel
+ * @param  Bus: Pointer to wide bus
+ * @param  Keys: Pointer to array to save key scan result of each attached
+ *               handler (see TM1629_ScanKeys)
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to read data or an asynchronous flush is in
+ *           progress
+ */
+TM1629_Result_t
+TM1629_WideBus_ScanKeys(TM1629_WideBus_t *Bus, uint32_t *Keys)
+{
+  uint8_t KeyRegs[TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS][4];
+  uint8_t Data = COMMAND_DATA_READING_WRITING_SETTING |
+                 COMMAND_DRWS_READ_KEY_SCANNING_DATA |
+                 COMMAND_DRWS_AUTO_INCREASE_OF_ADDRESS |
+                 COMMAND_DRWS_NORMAL_MODE;
+  int8_t Result = 0;
 
-      if (KeyRegs[j] & Kn)
-        KeysBuff |= 1;
-    }
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  if (TM1629_WideBus_Busy(Bus))
+    return TM1629_FAIL;
+#endif
 
-    Kn <<= 1;
-  }
+  TM1629_WideBus_StartCommunication(Bus);
+  Result = TM1629_WideBus_WriteCommand(Bus, Data);
+  if (Result >= 0)
+    Result = TM1629_WideBus_ReadBytes(Bus, KeyRegs, 4);
+  TM1629_WideBus_StopCommunication(Bus);
 
-  *Keys = KeysBuff;
+  for (uint8_t i = 0; i < Bus->NumOfHandlers; i++)
+  {
+    Bus->Handlers[i]->DataCommand = (Result >= 0) ? Data : 0;
+    Keys[i] = (Result >= 0) ? TM1629_DecodeKeys(KeyRegs[i]) : 0;
+  }
 
-  return TM1629_OK;
+  return (Result >= 0) ? TM1629_OK : TM1629_FAIL;
 }
+#endif
@@ -58,10 +58,130 @@ extern "C" {
   #define TM1629_CONFIG_SUPPORT_GPIO 1
 #endif
 
+#ifndef TM1629_CONFIG_SUPPORT_BUFFERED_MODE
+  #define TM1629_CONFIG_SUPPORT_BUFFERED_MODE  1
+#endif
+
+#ifndef TM1629_CONFIG_SUPPORT_BUS
+  #define TM1629_CONFIG_SUPPORT_BUS  0
+#endif
+
+#ifndef TM1629_CONFIG_BUS_MAX_HANDLERS
+  #define TM1629_CONFIG_BUS_MAX_HANDLERS  8
+#endif
+
+#if (TM1629_CONFIG_BUS_MAX_HANDLERS > 32)
+  #error "TM1629: A bus can not have more than 32 handlers!"
+#endif
+
+#ifndef TM1629_CONFIG_SUPPORT_WIDE_BUS
+  #define TM1629_CONFIG_SUPPORT_WIDE_BUS  0
+#endif
+
+#ifndef TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS
+  #define TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS  8
+#endif
+
+#if (TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS > 32)
+  #error "TM1629: A wide bus can not have more than 32 handlers!"
+#endif
+
+#ifndef TM1629_CONFIG_SUPPORT_WAVEFORM
+  #define TM1629_CONFIG_SUPPORT_WAVEFORM  0
+#endif
+
+#ifndef TM1629_CONFIG_SUPPORT_MMIO
+  #define TM1629_CONFIG_SUPPORT_MMIO  0
+#endif
+
+#ifndef TM1629_CONFIG_MMIO_STORE
+  #define TM1629_CONFIG_MMIO_STORE(REG, VALUE)  (*(REG) = (VALUE))
+#endif
+
+#ifndef TM1629_CONFIG_MMIO_LOAD
+  #define TM1629_CONFIG_MMIO_LOAD(REG)  (*(REG))
+#endif
+
+#ifndef TM1629_CONFIG_STATIC_PLATFORM
+  #define TM1629_CONFIG_STATIC_PLATFORM  0
+#endif
+
+#ifndef TM1629_CONFIG_STATIC_PLATFORM_HEADER
+  #define TM1629_CONFIG_STATIC_PLATFORM_HEADER  "TM1629_platform_static.h"
+#endif
+
+#ifndef TM1629_CONFIG_SHARED_PLATFORM_OPS
+  #define TM1629_CONFIG_SHARED_PLATFORM_OPS  0
+#endif
+
+#ifndef TM1629_CONFIG_SUPPORT_ASYNC
+  #define TM1629_CONFIG_SUPPORT_ASYNC  0
+#endif
+
+#ifndef TM1629_CONFIG_SUPPORT_TIMER
+  #define TM1629_CONFIG_SUPPORT_TIMER  0
+#endif
+
+#ifndef TM1629_CONFIG_ENABLE_STATS
+  #define TM1629_CONFIG_ENABLE_STATS  0
+#endif
+
+#ifndef TM1629_CONFIG_ENABLE_TRACE
+  #define TM1629_CONFIG_ENABLE_TRACE  0
+#endif
+
+#ifndef TM1629_CONFIG_ENABLE_CALIBRATION
+  #define TM1629_CONFIG_ENABLE_CALIBRATION  0
+#endif
+
+#ifndef TM1629_CONFIG_TRANSACTION_COST
+  #define TM1629_CONFIG_TRANSACTION_COST  8
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_COM_ANODE || TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+  #define TM1629_SUPPORT_SHADOW  1
+#else
+  #define TM1629_SUPPORT_SHADOW  0
+#endif
+
 #if (TM1629_CONFIG_SUPPORT_SPI == 0 && TM1629_CONFIG_SUPPORT_GPIO == 0)
   #error "TM1629: SPI and GPIO can not be both disabled!"
 #endif
 
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM && TM1629_CONFIG_SUPPORT_GPIO == 0)
+  #error "TM1629: Waveform playback needs GPIO support!"
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_MMIO && TM1629_CONFIG_SUPPORT_GPIO == 0)
+  #error "TM1629: MMIO needs GPIO support!"
+#endif
+
+#if (TM1629_CONFIG_STATIC_PLATFORM && TM1629_CONFIG_SUPPORT_GPIO == 0)
+  #error "TM1629: Static platform binding needs GPIO support!"
+#endif
+
+#if (TM1629_CONFIG_STATIC_PLATFORM && TM1629_CONFIG_SUPPORT_MMIO)
+  #error "TM1629: Static platform binding and MMIO can not be both enabled!"
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC && \
+     (TM1629_CONFIG_SUPPORT_GPIO == 0 || TM1629_SUPPORT_SHADOW == 0))
+  #error "TM1629: Async mode needs GPIO and COM_ANODE or BUFFERED_MODE support!"
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_TIMER && TM1629_CONFIG_SUPPORT_ASYNC == 0)
+  #error "TM1629: Timer mode needs async mode support!"
+#endif
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION && TM1629_CONFIG_SUPPORT_GPIO == 0)
+  #error "TM1629: Calibration needs GPIO support!"
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS && \
+     (TM1629_CONFIG_SUPPORT_GPIO == 0 || TM1629_SUPPORT_SHADOW == 0))
+  #error "TM1629: Wide bus needs GPIO and COM_ANODE or BUFFERED_MODE support!"
+#endif
+
 
 /* Exported Constants -----------------------------------------------------------*/
 #define TM1629_DISPLAY_STATE_OFF          0
@@ -69,6 +189,27 @@ extern "C" {
 
 #define TM1629_DECIMAL_POINT              0x80
 
+/**
+ * @brief  Default bus timing profile in nanoseconds (used by TM1629_Init)
+ */
+#define TM1629_TIMING_DEFAULT_CLOCK_HIGH_NS   1000
+#define TM1629_TIMING_DEFAULT_CLOCK_LOW_NS    1000
+#define TM1629_TIMING_DEFAULT_TURNAROUND_NS   5000
+#define TM1629_TIMING_DEFAULT_BYTE_GAP_NS     2000
+#define TM1629_TIMING_DEFAULT_STROBE_NS       1000
+
+/**
+ * @brief  Size of the largest transfer (address command + whole display RAM)
+ */
+#define TM1629_FRAME_SIZE                 17
+
+/**
+ * @brief  Size of the queue of an asynchronous flush (data setting command and
+ *         up to 16 transactions sending 16 bytes)
+ */
+#define TM1629_ASYNC_MAX_FRAMES           17
+#define TM1629_ASYNC_BUFFER_SIZE          33
+
   
 /* Exported Data Types ----------------------------------------------------------*/
 
@@ -92,6 +233,33 @@ typedef enum TM1629_DisplayType_e
 } TM1629_DisplayType_t;
 
 
+/**
+ * @brief  Kind of STB framed transactions
+ */
+typedef enum TM1629_TraceKind_e
+{
+  TM1629_TRACE_KIND_DATA_COMMAND = 0,
+  TM1629_TRACE_KIND_DISPLAY_CONTROL,
+  TM1629_TRACE_KIND_WRITE_DISPLAY,
+  TM1629_TRACE_KIND_READ_KEYS,
+} TM1629_TraceKind_t;
+
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+/**
+ * @brief  Format of the port words of a compiled waveform
+ */
+typedef enum TM1629_WaveformFormat_e
+{
+  // Output data register value: 'Base' plus the masks of high pins
+  TM1629_WAVEFORM_FORMAT_VALUE = 0,
+  // Bit set/reset register value: masks of high pins in bits 0-15 and masks
+  // of low pins in bits 16-31 (all masks must fit in bits 0-15)
+  TM1629_WAVEFORM_FORMAT_SET_RESET,
+} TM1629_WaveformFormat_t;
+#endif
+
+
 /**
  * @brief  Communication type
  */
@@ -104,15 +272,17 @@ typedef enum TM1629_Communication_e
 
 /**
  * @brief  Function type for Initialize/Deinitialize the platform dependent layer.
+ * @param  Context: Platform context of the handler ('Platform.Context')
  * @retval 
  *         -  0: The operation was successful.
  *         - -1: The operation failed. 
  */
-typedef int8_t (*TM1629_Platform_InitDeinit_t)(void);
+typedef int8_t (*TM1629_Platform_InitDeinit_t)(void *Context);
 
 
 /**
  * @brief  Function type for GPIO write
+ * @param  Context: Platform context of the handler ('Platform.Context')
  * @param  State: GPIO state
  *              - 0: Low
  *              - 1: High
@@ -121,12 +291,13 @@ typedef int8_t (*TM1629_Platform_InitDeinit_t)(void);
  *         -  0: The operation was successful.
  *         - -1: The operation failed. 
  */
-typedef int8_t (*TM1629_Platform_GPIO_Write_t)(uint8_t State);
+typedef int8_t (*TM1629_Platform_GPIO_Write_t)(void *Context, uint8_t State);
 
 
 #if (TM1629_CONFIG_SUPPORT_GPIO)
 /**
  * @brief  Function type for GPIO configuration
+ * @param  Context: Platform context of the handler ('Platform.Context')
  * @param  Dir: GPIO direction
  *              - 0: Input
  *              - 1: Output
@@ -135,27 +306,254 @@ typedef int8_t (*TM1629_Platform_GPIO_Write_t)(uint8_t State);
  *         -  0: The operation was successful.
  *         - -1: The operation failed. 
  */
-typedef int8_t (*TM1629_Platform_GPIO_Config_t)(uint8_t Dir);
+typedef int8_t (*TM1629_Platform_GPIO_Config_t)(void *Context, uint8_t Dir);
 
 
 /**
  * @brief  Function type for GPIO read
+ * @param  Context: Platform context of the handler ('Platform.Context')
  * @retval
  *         -  0: Low
  *         -  1: High
  *         - -1: The operation failed. 
  */
-typedef int8_t (*TM1629_Platform_GPIO_Read_t)(void);
+typedef int8_t (*TM1629_Platform_GPIO_Read_t)(void *Context);
 
 
 /**
  * @brief  Function type for Delay
+ * @param  Context: Platform context of the handler ('Platform.Context')
  * @param  Delay: Delay time in milliseconds/microseconds
  * @retval 
  *         -  0: The operation was successful.
  *         - -1: The operation failed. 
  */
-typedef int8_t (*TM1629_Platform_Delay_t)(uint8_t Delay);
+typedef int8_t (*TM1629_Platform_Delay_t)(void *Context, uint8_t Delay);
+
+
+/**
+ * @brief  Function type for Delay in nanoseconds
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @param  Delay: Delay time in nanoseconds
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_DelayNs_t)(void *Context, uint16_t Delay);
+
+
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+/**
+ * @brief  Function type for starting a periodic timer that calls
+ *         TM1629_TimerTick
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @param  PeriodNs: Period of the timer in nanoseconds
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_TimerStart_t)(void *Context, uint32_t PeriodNs);
+
+
+/**
+ * @brief  Function type for stopping the periodic timer
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @note   It is called from TM1629_TimerTick (interrupt context).
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_TimerStop_t)(void *Context);
+#endif
+
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+/**
+ * @brief  Function type for reading a free running nanosecond clock
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @retval Time in nanoseconds (wraps around)
+ */
+typedef uint32_t (*TM1629_Platform_GetTimeNs_t)(void *Context);
+#endif
+
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+/**
+ * @brief  Function type for reading a free running clock
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @retval Time in microseconds (wraps around)
+ */
+typedef uint32_t (*TM1629_Platform_GetTime_t)(void *Context);
+#endif
+
+
+/**
+ * @brief  Function type for writing a buffer through GPIO
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @param  Data: Pointer to data to be sent
+ * @param  NumOfBytes: Number of bytes to send
+ * @note   Each byte must be clocked out LSB first. CLK must be left high after
+ *         the last bit. DIO is already configured as output by the driver.
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_Buffer_Write_t)(void *Context,
+                                                 const uint8_t *Data,
+                                                 uint8_t NumOfBytes);
+
+
+/**
+ * @brief  Function type for reading a buffer through GPIO
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @param  Data: Pointer to save received data
+ * @param  NumOfBytes: Number of bytes to receive
+ * @note   Each byte must be clocked in LSB first. DIO is already configured as
+ *         input by the driver and the turnaround delay is already passed. The
+ *         port is responsible for the gap between bytes.
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_Buffer_Read_t)(void *Context,
+                                                uint8_t *Data,
+                                                uint8_t NumOfBytes);
+
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+/**
+ * @brief  Function type for playing a compiled waveform on the GPIO port
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @param  Words: Port words ('GPIO.Waveform.Buffer')
+ * @param  NumOfWords: Number of words to play
+ * @note   Each word must be written to the port 'GPIO.Waveform.TickNs' after
+ *         the previous one (e.g. by a timer triggered DMA to the output or bit
+ *         set/reset register). The waveform starts with STB going low and
+ *         ends with STB high, so the transfer must be completed before
+ *         returning. DIO is already configured as output by the driver.
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_Waveform_Play_t)(void *Context,
+                                                  const uint32_t *Words,
+                                                  uint16_t NumOfWords);
+#endif
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+/**
+ * @brief  Function type for SPI write
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @param  Data: Pointer to data to be sent
+ * @param  NumOfBytes: Number of bytes to send
+ * @note   The bus must be configured as half-duplex (3-wire), SPI mode 3
+ *         (CPOL = 1, CPHA = 1) and LSB first. If the peripheral can only shift
+ *         MSB first, set 'SPI.MSBFirst' and the driver reverses the bits.
+ * @note   'Data' always points to a word-aligned buffer inside the handler, so
+ *         it can be handed to a DMA controller as is. The buffer is reused
+ *         after the function returns, so the transfer must be completed
+ *         before returning.
+ * @note   The driver raises STB right after the last byte of a transaction
+ *         and may lower it again for the next one without any delay. It is up
+ *         to the port to keep STB high for at least tPW_STB (1 us), e.g. by
+ *         waiting in WriteSTB after raising STB.
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_SPI_Write_t)(void *Context,
+                                              const uint8_t *Data,
+                                              uint8_t NumOfBytes);
+
+
+/**
+ * @brief  Function type for SPI read
+ * @param  Context: Platform context of the handler ('Platform.Context')
+ * @param  Data: Pointer to save received data
+ * @param  NumOfBytes: Number of bytes to receive
+ * @note   The function is called right after the read command is sent. It is
+ *         up to the port to release the data line and wait for the turnaround
+ *         time (tWAIT) before clocking in the data.
+ * @note   'Data' follows the same buffer contract as the write function.
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_SPI_Read_t)(void *Context,
+                                             uint8_t *Data,
+                                             uint8_t NumOfBytes);
+#endif
+
+
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+/**
+ * @brief  Platform dependent layer functions shared by handlers
+ * @note   Members are the same as the functions of TM1629_Platform_t (with the
+ *         same optional ones). One const table can be linked to any number of
+ *         handlers by TM1629_PLATFORM_LINK_OPS; each handler keeps its own
+ *         'Platform.Context'.
+ */
+typedef struct TM1629_PlatformOps_s
+{
+  TM1629_Platform_InitDeinit_t Init;
+  TM1629_Platform_InitDeinit_t DeInit;
+
+  TM1629_Platform_GPIO_Write_t WriteSTB;
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+  TM1629_Platform_GetTime_t GetTimeUs;
+#endif
+
+  union
+  {
+#if TM1629_CONFIG_SUPPORT_GPIO
+    struct
+    {
+      TM1629_Platform_GPIO_Config_t DirDIO;
+      TM1629_Platform_GPIO_Write_t WriteDIO;
+      TM1629_Platform_GPIO_Read_t ReadDIO;
+      TM1629_Platform_GPIO_Write_t WriteCLK;
+
+      TM1629_Platform_Delay_t DelayUs;
+      TM1629_Platform_DelayNs_t DelayNs;
+
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+      TM1629_Platform_TimerStart_t TimerStart;
+      TM1629_Platform_TimerStop_t TimerStop;
+#endif
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+      TM1629_Platform_GetTimeNs_t GetTimeNs;
+#endif
+
+      TM1629_Platform_Buffer_Write_t WriteBuffer;
+      TM1629_Platform_Buffer_Read_t ReadBuffer;
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+      struct
+      {
+        TM1629_Platform_Waveform_Play_t Play;
+      } Waveform;
+#endif
+    } GPIO;
+#endif
+
+#if TM1629_CONFIG_SUPPORT_SPI
+    struct
+    {
+      TM1629_Platform_SPI_Write_t Write;
+      TM1629_Platform_SPI_Read_t Read;
+    } SPI;
+#endif
+  };
+} TM1629_PlatformOps_t;
 #endif
 
 
@@ -164,7 +562,22 @@ typedef int8_t (*TM1629_Platform_Delay_t)(uint8_t Delay);
  * @note   It is optional to initialize this functions:
  *         - Init
  *         - DeInit
- * @note   If success the functions must return 0 
+ *         - GPIO.DelayUs (if GPIO.DelayNs is initialized)
+ *         - GPIO.DelayNs
+ *         - GPIO.WriteBuffer
+ *         - GPIO.ReadBuffer
+ *         - GPIO.Waveform.Play
+ *         - GPIO.WriteDIO, GPIO.WriteCLK and GPIO.ReadDIO (if GPIO.MMIO is set)
+ *         - WriteSTB (if GPIO.MMIO is set with an STB pin)
+ *         - WriteSTB, GPIO.DirDIO, GPIO.WriteDIO, GPIO.ReadDIO, GPIO.WriteCLK,
+ *           GPIO.DelayUs and GPIO.DelayNs (if TM1629_CONFIG_STATIC_PLATFORM is
+ *           enabled, they are not used)
+ * @note   If success the functions must return 0
+ * @note   'Context' is passed to every function as is, so one set of functions
+ *         can drive any number of handlers.
+ * @note   If TM1629_CONFIG_SHARED_PLATFORM_OPS is enabled, the functions are in
+ *         the table pointed by 'Ops' (TM1629_PlatformOps_t) and only the other
+ *         members are kept in the handler.
  */
 typedef struct TM1629_Platform_s
 {
@@ -173,6 +586,13 @@ typedef struct TM1629_Platform_s
   TM1629_Communication_t Communication;
 #endif
 
+  // User context passed to platform dependent layer functions
+  void *Context;
+
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  // Platform dependent layer functions (shared by handlers)
+  const TM1629_PlatformOps_t *Ops;
+#else
   // Initialize platform dependent layer
   TM1629_Platform_InitDeinit_t Init;
   // De-initialize platform dependent layer
@@ -181,13 +601,24 @@ typedef struct TM1629_Platform_s
   // Write STB pin
   TM1629_Platform_GPIO_Write_t WriteSTB;
 
+#if (TM1629_CONFIG_ENABLE_STATS)
+  // Read a microsecond clock (optional, for TM1629_Stats_t.BusyUs)
+  TM1629_Platform_GetTime_t GetTimeUs;
+#endif
+#endif
+
+#if (!TM1629_CONFIG_SHARED_PLATFORM_OPS || TM1629_CONFIG_SUPPORT_SPI || \
+     TM1629_CONFIG_SUPPORT_MMIO || TM1629_CONFIG_SUPPORT_WAVEFORM)
   union
   {
-#if TM1629_CONFIG_SUPPORT_GPIO
+#if (TM1629_CONFIG_SUPPORT_GPIO && \
+     (!TM1629_CONFIG_SHARED_PLATFORM_OPS || \
+      TM1629_CONFIG_SUPPORT_MMIO || TM1629_CONFIG_SUPPORT_WAVEFORM))
     // It is It is up to the user to use a 3-wire interface (by shorting the DIN
     // and DOUT signals together) or 4-wire (separate DIN and DOUT signals).
     struct
     {
+#if (!TM1629_CONFIG_SHARED_PLATFORM_OPS)
       // DIO pin(s) configuration
       TM1629_Platform_GPIO_Config_t DirDIO;
       // DIO pin write
@@ -200,19 +631,255 @@ typedef struct TM1629_Platform_s
 
       // Delay function in microseconds
       TM1629_Platform_Delay_t DelayUs;
+      // Delay function in nanoseconds (optional, preferred over DelayUs)
+      TM1629_Platform_DelayNs_t DelayNs;
+
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+      // Start and stop the timer calling TM1629_TimerTick (optional, both or
+      // none)
+      TM1629_Platform_TimerStart_t TimerStart;
+      TM1629_Platform_TimerStop_t TimerStop;
+#endif
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+      // Read a nanosecond clock (optional, enables TM1629_Calibrate)
+      TM1629_Platform_GetTimeNs_t GetTimeNs;
+#endif
+
+      // Write whole buffer (optional, replaces the bit loop of the driver)
+      TM1629_Platform_Buffer_Write_t WriteBuffer;
+      // Read whole buffer (optional, replaces the bit loop of the driver)
+      TM1629_Platform_Buffer_Read_t ReadBuffer;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+      // GPIO registers written by the driver itself (optional, replaces the
+      // pin functions when 'Set' is not NULL). All pins must be on one port.
+      struct
+      {
+        // Writing 1 to a bit drives the pin high (Set) or low (Clear)
+        volatile uint32_t *Set;
+        volatile uint32_t *Clear;
+        // Input levels of the pins
+        volatile const uint32_t *Input;
+        // Pins on the port (STBMask 0: STB is written by WriteSTB)
+        uint32_t STBMask;
+        uint32_t CLKMask;
+        // DIO pin driven by the driver and DIO pin read by the driver (the
+        // same pin in 3-wire interface)
+        uint32_t DIOMask;
+        uint32_t DIOInputMask;
+      } MMIO;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+      // Write transactions compiled to port words (optional, replaces the
+      // pin functions and WriteBuffer for write transactions)
+      struct
+      {
+#if (!TM1629_CONFIG_SHARED_PLATFORM_OPS)
+        // Play compiled waveform
+        TM1629_Platform_Waveform_Play_t Play;
+#endif
+        // Buffer of compiled waveform and its size in words. Transactions
+        // not fitting in the buffer use the pin functions.
+        uint32_t *Buffer;
+        uint16_t Size;
+        // Time each word stays on the port (ns)
+        uint16_t TickNs;
+        // Format of port words (TM1629_WaveformFormat_t)
+        uint8_t Format;
+        // Pins on the port
+        uint32_t STBMask;
+        uint32_t CLKMask;
+        uint32_t DIOMask;
+        // State of other pins of the port (TM1629_WAVEFORM_FORMAT_VALUE)
+        uint32_t Base;
+      } Waveform;
+#endif
     } GPIO;
 #endif
 
 #if TM1629_CONFIG_SUPPORT_SPI
     struct
     {
-      // Will be used in future
+#if (!TM1629_CONFIG_SHARED_PLATFORM_OPS)
+      // Half-duplex write
+      TM1629_Platform_SPI_Write_t Write;
+      // Half-duplex read
+      TM1629_Platform_SPI_Read_t Read;
+#endif
+
+      // Peripheral shifts MSB first (driver reverses the bits of each byte)
+      uint8_t MSBFirst;
     } SPI;
 #endif
   };
+#endif
 } TM1629_Platform_t;
 
 
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+/**
+ * @brief  Bus timing profile of GPIO communication
+ * @note   All values are in nanoseconds. A zero value skips the delay call.
+ */
+typedef struct TM1629_Timing_s
+{
+  // CLK high time of each bit
+  uint16_t ClockHighNs;
+  // CLK low time of each bit
+  uint16_t ClockLowNs;
+  // Wait time between releasing DIO and clocking the first read bit
+  uint16_t TurnaroundNs;
+  // Gap between read bytes
+  uint16_t ByteGapNs;
+  // STB high time after each transaction
+  uint16_t StrobeNs;
+} TM1629_Timing_t;
+#endif
+
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+/**
+ * @brief  Result of GPIO delay calibration (see TM1629_Calibrate)
+ * @note   A calibrated delay is a busy-wait loop in the driver. Its loop
+ *         count covers the time of the timing profile left after the cost of
+ *         the pin write call that ends the delay.
+ */
+typedef struct TM1629_Calibration_s
+{
+  // Delays use 'Loops' instead of the delay functions of the platform
+  uint8_t Valid;
+  // Measured cost of one pin write call (ns)
+  uint16_t PinWriteNs;
+  // Measured cost of one busy-wait loop (1/16 ns)
+  uint16_t LoopCost;
+  // Loop counts of each delay of the timing profile (same fields as
+  // 'Timing' counted in loops, 0: No delay, 0xFFFF: The delay function is
+  // used)
+  TM1629_Timing_t Loops;
+} TM1629_Calibration_t;
+#endif
+
+
+#if (TM1629_SUPPORT_SHADOW)
+/**
+ * @brief  Flush plan data type
+ * @note   Costs are in bit times. Each STB framed transaction costs
+ *         'TM1629_CONFIG_TRANSACTION_COST' plus 8 for every byte.
+ */
+typedef struct TM1629_FlushPlan_s
+{
+  // Data setting command selecting the write mode (auto-increment)
+  uint8_t DataCommand;
+  // The data setting command must be sent before the writes
+  uint8_t SendDataCommand;
+  // Number of write transactions
+  uint8_t NumOfWrites;
+  // Write transactions (address + number of bytes from the shadow)
+  struct
+  {
+    uint8_t Addr;
+    uint8_t Count;
+  } Writes[16];
+  // Total estimated bus cost of the plan
+  uint16_t Cost;
+} TM1629_FlushPlan_t;
+#endif
+
+
+#if (TM1629_CONFIG_ENABLE_TRACE)
+/**
+ * @brief  Function type for transaction trace hooks
+ * @param  Handler: Pointer to handler
+ * @param  Kind: Kind of the transaction
+ * @param  Command: First byte of the transaction
+ * @param  Length: Number of bytes after the command byte (written or read)
+ * @retval None
+ */
+struct TM1629_Handler_s;
+
+typedef void (*TM1629_Trace_Hook_t)(const struct TM1629_Handler_s *Handler,
+                                    TM1629_TraceKind_t Kind,
+                                    uint8_t Command, uint8_t Length);
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+/**
+ * @brief  Function type for completion callback of asynchronous flush
+ * @param  Handler: Pointer to handler
+ * @param  Result: Result of the flush
+ *         - TM1629_OK: All queued transactions were sent
+ *         - TM1629_FAIL: A platform function failed, the shadow is sent again
+ *                        by the next flush
+ * @retval None
+ */
+struct TM1629_Handler_s;
+
+typedef void (*TM1629_Async_Done_t)(struct TM1629_Handler_s *Handler,
+                                    TM1629_Result_t Result);
+
+
+/**
+ * @brief  State of asynchronous flush
+ */
+typedef struct TM1629_Async_s
+{
+  // Bytes of the queued transactions (copied from the shadow)
+  uint8_t Bytes[TM1629_ASYNC_BUFFER_SIZE];
+  // Number of bytes of each queued transaction
+  uint8_t Lengths[TM1629_ASYNC_MAX_FRAMES];
+  uint8_t NumOfFrames;
+
+  // Current transaction, its first byte in 'Bytes' and sent bytes of it
+  uint8_t Frame;
+  uint8_t Index;
+  uint8_t Sent;
+  // Current CLK edge of the byte (even: falling, odd: rising)
+  uint8_t Edge;
+  // STB of the current transaction is low
+  uint8_t Started;
+  // A flush is in progress (cleared by TM1629_TimerTick in timer mode)
+  volatile uint8_t Busy;
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+  // The flush is driven by the timer
+  uint8_t Timer;
+#endif
+
+  // Completion callback (optional)
+  TM1629_Async_Done_t Done;
+  // User context of completion callback
+  void *Context;
+} TM1629_Async_t;
+#endif
+
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+/**
+ * @brief  Runtime statistics of a handler
+ */
+typedef struct TM1629_Stats_s
+{
+  // STB framed transactions
+  uint32_t Transactions;
+  // Bytes sent to and received from the chip
+  uint32_t BytesWritten;
+  uint32_t BytesRead;
+  // Bits clocked in both directions
+  uint32_t BitsClocked;
+  // DIO direction switches
+  uint32_t DirDIOSwitches;
+  // Data setting and display control commands not sent because the chip
+  // was already in the requested state
+  uint32_t CommandsSuppressed;
+  // Time STB was low (needs GetTimeUs platform function)
+  uint32_t BusyUs;
+} TM1629_Stats_t;
+#endif
+
+
 /**
  * @brief  Handler data type
  * @note   User must initialize platform dependent layer functions
@@ -222,97 +889,638 @@ typedef struct TM1629_Handler_s
   // Display type (Common-Cathode or Common-Anode)
   TM1629_DisplayType_t DisplayType;
 
-#if (TM1629_CONFIG_SUPPORT_COM_ANODE)
+  // Last data setting command sent to the chip (0: Unknown)
+  uint8_t DataCommand;
+  // Last display control command sent to the chip (0: Unknown)
+  uint8_t DisplayControl;
+
+#if (TM1629_SUPPORT_SHADOW)
+  // Shadow of the display RAM of the chip
   uint8_t DisplayRegister[16];
+  // Bytes of the shadow not sent to the chip yet (bit n => address n)
+  uint16_t DirtyMask;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+  // Display functions only update the shadow until TM1629_Flush is called
+  uint8_t Buffered;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+  // DMA-friendly transfer buffer of SPI communication
+  union
+  {
+    uint32_t Align;
+    uint8_t Bytes[TM1629_FRAME_SIZE];
+  } SPIBuffer;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+  // Bus timing profile of GPIO communication
+  TM1629_Timing_t Timing;
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+  // Delay calibration of the timing profile
+  TM1629_Calibration_t Calibration;
+#endif
+
+  // Last configured DIO direction (0: Input, 1: Output, 0xFF: Unknown)
+  uint8_t DirDIO;
+  // Number of DIO direction switches avoided
+  uint32_t DirDIOSkipped;
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+  // Transaction compiled in 'Platform.GPIO.Waveform.Buffer' (played again
+  // without compiling while the same bytes are sent, 0 bytes: Nothing). The
+  // waveform macros, TM1629_SetTiming and TM1629_Init clear it.
+  uint8_t WaveformFrame[TM1629_FRAME_SIZE];
+  uint8_t WaveformBytes;
+  uint16_t WaveformWords;
+#endif
+#endif
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+  // Runtime statistics
+  TM1629_Stats_t Stats;
+  // Start time of the current transaction
+  uint32_t BusyStartUs;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_BUS)
+  // Shared bus the chip is connected to (NULL: Dedicated pins)
+  struct TM1629_Bus_s *Bus;
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+  // Asynchronous flush state
+  TM1629_Async_t Async;
+#endif
+
+#if (TM1629_CONFIG_ENABLE_TRACE)
+  // Called before STB goes low and after STB goes high (optional)
+  TM1629_Trace_Hook_t TraceBegin;
+  TM1629_Trace_Hook_t TraceEnd;
+  // User context of trace hooks
+  void *TraceContext;
+#endif
+
+  // Platform dependent layer
+  TM1629_Platform_t Platform;
+} TM1629_Handler_t;
+
+
+#if (TM1629_CONFIG_SUPPORT_BUS)
+/**
+ * @brief  Function type for writing several STB pins at once
+ * @param  Context: Context of the bus ('Bus.Context')
+ * @param  Mask: STB pins to write (bit n => n-th handler attached to the bus)
+ * @param  State: GPIO state
+ *              - 0: Low
+ *              - 1: High
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_STB_Mask_Write_t)(void *Context,
+                                                   uint32_t Mask,
+                                                   uint8_t State);
+
+
+/**
+ * @brief  Shared bus data type
+ * @note   Several chips share CLK and DIO lines and each one has its own STB
+ *         pin. Each chip still has its own handler for unicast access, and
+ *         the bus broadcasts identical transactions to several chips at once.
+ * @note   Transactions are clocked through the platform functions of the
+ *         first selected handler.
+ */
+typedef struct TM1629_Bus_s
+{
+  // Attached handlers (bit n of masks => Handlers[n])
+  TM1629_Handler_t *Handlers[TM1629_CONFIG_BUS_MAX_HANDLERS];
+  uint8_t NumOfHandlers;
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+  // DIO direction shared by all attached handlers
+  uint8_t DirDIO;
+#endif
+
+  // Context passed to WriteSTBMask
+  void *Context;
+  // Write several STB pins at once (optional, otherwise WriteSTB of each
+  // handler is called)
+  TM1629_Platform_STB_Mask_Write_t WriteSTBMask;
+} TM1629_Bus_t;
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Function type for writing several pins of a GPIO port at once
+ * @param  Context: Context of the wide bus ('WideBus.Context')
+ * @param  Mask: Pins to write
+ * @param  Value: New state of the pins (bits outside Mask must be ignored)
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_Port_Write_t)(void *Context,
+                                               uint32_t Mask,
+                                               uint32_t Value);
+
+/**
+ * @brief  Function type for reading all pins of a GPIO port
+ * @param  Context: Context of the wide bus ('WideBus.Context')
+ * @param  Value: Pointer to save state of the pins
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_Port_Read_t)(void *Context, uint32_t *Value);
+
+/**
+ * @brief  Function type for configuring direction of several pins of a
+ *         GPIO port at once
+ * @param  Context: Context of the wide bus ('WideBus.Context')
+ * @param  Mask: Pins to configure
+ * @param  Dir: GPIO direction
+ *              - 0: Input
+ *              - 1: Output
+ *
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+typedef int8_t (*TM1629_Platform_Port_Config_t)(void *Context,
+                                                uint32_t Mask,
+                                                uint8_t Dir);
+
+
+/**
+ * @brief  Wide bus data type
+ * @note   Several chips share CLK and STB lines and each one has its own DIO
+ *         pin on the same GPIO port. Each bit is clocked to (or read from)
+ *         all chips with one port access, so refreshing N chips takes the
+ *         bus time of one.
+ * @note   Attached handlers hold the display RAM shadow and state caches of
+ *         each chip. Their own platform functions are not used by the bus.
+ */
+typedef struct TM1629_WideBus_s
+{
+  // Attached handlers and their DIO pin on the port
+  TM1629_Handler_t *Handlers[TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS];
+  uint32_t DIOMask[TM1629_CONFIG_WIDE_BUS_MAX_HANDLERS];
+  uint8_t NumOfHandlers;
+  // DIO pins of all attached handlers
+  uint32_t PortMask;
+
+  // CLK pin when it is on the same port (0: CLK is written by WriteCLK)
+  uint32_t CLKMask;
+
+  // Bus timing profile
+  TM1629_Timing_t Timing;
+  // Last configured direction of DIO pins (0: Input, 1: Output, 0xFF: Unknown)
+  uint8_t DirDIO;
+
+  // Context passed to platform functions of the bus
+  void *Context;
+  // Write STB pin shared by all chips
+  TM1629_Platform_GPIO_Write_t WriteSTB;
+  // Write CLK pin shared by all chips (not needed when CLKMask is set)
+  TM1629_Platform_GPIO_Write_t WriteCLK;
+  // Config direction of DIO pins
+  TM1629_Platform_Port_Config_t DirPort;
+  // Write DIO pins (and CLK pin when CLKMask is set)
+  TM1629_Platform_Port_Write_t WritePort;
+  // Read DIO pins
+  TM1629_Platform_Port_Read_t ReadPort;
+  // Delay (us), needed if DelayNs is not linked
+  TM1629_Platform_Delay_t DelayUs;
+  // Delay (ns), optional
+  TM1629_Platform_DelayNs_t DelayNs;
+} TM1629_WideBus_t;
+#endif
+
+
+/* Exported Macros --------------------------------------------------------------*/
+#if (TM1629_CONFIG_SUPPORT_SPI && TM1629_CONFIG_SUPPORT_GPIO)
+/**
+ * @brief  Link platform dependent layer communication type
+ * @param  HANDLER: Pointer to handler
+ * @param  COM: Communication type
+ *         - TM1629_COMMUNICATION_GPIO
+ *         - TM1629_COMMUNICATION_SPI
+ * 
+ */
+#define TM1629_PLATFORM_SET_COMMUNICATION(HANDLER, COM) \
+  (HANDLER)->Platform.Communication = COM
+#else
+#define TM1629_PLATFORM_SET_COMMUNICATION(HANDLER, COM) \
+  do {} while(0)
+#endif
+
+/**
+ * @brief  Set context of platform dependent layer functions
+ * @param  HANDLER: Pointer to handler
+ * @param  CONTEXT: Pointer passed to platform dependent layer functions
+ */
+#define TM1629_PLATFORM_SET_CONTEXT(HANDLER, CONTEXT) \
+  (HANDLER)->Platform.Context = (void *)(CONTEXT)
+
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+/**
+ * @brief  Link shared table of platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  OPS: Pointer to const table (TM1629_PlatformOps_t)
+ */
+#define TM1629_PLATFORM_LINK_OPS(HANDLER, OPS) \
+  (HANDLER)->Platform.Ops = OPS
+
+/**
+ * @brief  Get platform dependent layer functions of a platform layer
+ * @param  PLATFORM: Pointer to platform layer (TM1629_Platform_t)
+ * @retval Pointer to the functions ('Init', 'GPIO.WriteDIO', ...)
+ */
+#define TM1629_PLATFORM_OPS(PLATFORM)  ((PLATFORM)->Ops)
+#else
+#define TM1629_PLATFORM_OPS(PLATFORM)  (PLATFORM)
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_INIT(HANDLER, FUNC) \
+  (HANDLER)->Platform.Init = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_DEINIT(HANDLER, FUNC) \
+  (HANDLER)->Platform.DeInit = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_WRITE_STB(HANDLER, FUNC) \
+  (HANDLER)->Platform.WriteSTB = FUNC
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_GET_TIME_US(HANDLER, FUNC) \
+  (HANDLER)->Platform.GetTimeUs = FUNC
+#endif
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+#if (!TM1629_CONFIG_SHARED_PLATFORM_OPS)
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_DIR_DIO(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.DirDIO = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_WRITE_DIO(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.WriteDIO = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+
+#define TM1629_PLATFORM_LINK_READ_DIO(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.ReadDIO = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_WRITE_CLK(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.WriteCLK = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_DELAY_US(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.DelayUs = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_DELAY_NS(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.DelayNs = FUNC
+
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_TIMER_START(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.TimerStart = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_TIMER_STOP(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.TimerStop = FUNC
+#endif
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_GET_TIME_NS(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.GetTimeNs = FUNC
+#endif
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_WRITE_BUFFER(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.WriteBuffer = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_READ_BUFFER(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.ReadBuffer = FUNC
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+/**
+ * @brief  Set GPIO registers written by the driver itself
+ * @param  HANDLER: Pointer to handler
+ * @param  SET: Pointer to bit set register of the port (NULL: Pin functions
+ *              are used)
+ * @param  CLEAR: Pointer to bit clear register of the port
+ * @param  INPUT: Pointer to input data register of the port
+ */
+#define TM1629_PLATFORM_SET_MMIO_REGS(HANDLER, SET, CLEAR, INPUT) \
+  do { (HANDLER)->Platform.GPIO.MMIO.Set = SET;                  \
+       (HANDLER)->Platform.GPIO.MMIO.Clear = CLEAR;              \
+       (HANDLER)->Platform.GPIO.MMIO.Input = INPUT; } while (0)
+
+/**
+ * @brief  Set pins written by the driver itself
+ * @param  HANDLER: Pointer to handler
+ * @param  STB: STB pin mask (0: STB is written by WriteSTB)
+ * @param  CLK: CLK pin mask
+ * @param  DIO: Driven DIO pin mask
+ * @param  DIO_IN: Read DIO pin mask
+ */
+#define TM1629_PLATFORM_SET_MMIO_PINS(HANDLER, STB, CLK, DIO, DIO_IN) \
+  do { (HANDLER)->Platform.GPIO.MMIO.STBMask = STB;                  \
+       (HANDLER)->Platform.GPIO.MMIO.CLKMask = CLK;                  \
+       (HANDLER)->Platform.GPIO.MMIO.DIOMask = DIO;                  \
+       (HANDLER)->Platform.GPIO.MMIO.DIOInputMask = DIO_IN; } while (0)
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+#if (!TM1629_CONFIG_SHARED_PLATFORM_OPS)
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_PLAY_WAVEFORM(HANDLER, FUNC) \
+  (HANDLER)->Platform.GPIO.Waveform.Play = FUNC
+#endif
+
+/**
+ * @brief  Set buffer of compiled waveform
+ * @param  HANDLER: Pointer to handler
+ * @param  BUFFER: Pointer to buffer of port words
+ * @param  SIZE: Size of the buffer in words
+ * @param  TICK_NS: Time each word stays on the port (ns)
+ * @note   The cached transaction is dropped, so the next one is compiled.
+ */
+#define TM1629_PLATFORM_SET_WAVEFORM_BUFFER(HANDLER, BUFFER, SIZE, TICK_NS) \
+  do { (HANDLER)->Platform.GPIO.Waveform.Buffer = BUFFER;                  \
+       (HANDLER)->Platform.GPIO.Waveform.Size = SIZE;                      \
+       (HANDLER)->Platform.GPIO.Waveform.TickNs = TICK_NS;                 \
+       (HANDLER)->WaveformBytes = 0; } while (0)
+
+/**
+ * @brief  Set pins of compiled waveform on the port
+ * @param  HANDLER: Pointer to handler
+ * @param  FORMAT: Format of port words (TM1629_WaveformFormat_t)
+ * @param  STB: STB pin mask
+ * @param  CLK: CLK pin mask
+ * @param  DIO: DIO pin mask
+ * @param  BASE: State of other pins of the port (TM1629_WAVEFORM_FORMAT_VALUE)
+ * @note   The cached transaction is dropped, so the next one is compiled.
+ */
+#define TM1629_PLATFORM_SET_WAVEFORM_PINS(HANDLER, FORMAT, STB, CLK, DIO, BASE) \
+  do { (HANDLER)->Platform.GPIO.Waveform.Format = FORMAT;                      \
+       (HANDLER)->Platform.GPIO.Waveform.STBMask = STB;                        \
+       (HANDLER)->Platform.GPIO.Waveform.CLKMask = CLK;                        \
+       (HANDLER)->Platform.GPIO.Waveform.DIOMask = DIO;                        \
+       (HANDLER)->Platform.GPIO.Waveform.Base = BASE;                          \
+       (HANDLER)->WaveformBytes = 0; } while (0)
+#endif
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_SPI)
+#if (!TM1629_CONFIG_SHARED_PLATFORM_OPS)
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_SPI_WRITE(HANDLER, FUNC) \
+  (HANDLER)->Platform.SPI.Write = FUNC
+
+/**
+ * @brief  Link platform dependent layer functions to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name
+ */
+#define TM1629_PLATFORM_LINK_SPI_READ(HANDLER, FUNC) \
+  (HANDLER)->Platform.SPI.Read = FUNC
+#endif
+
+/**
+ * @brief  Set bit order of SPI peripheral
+ * @param  HANDLER: Pointer to handler
+ * @param  MSB: Bit order
+ *         - 0: Peripheral shifts LSB first
+ *         - 1: Peripheral shifts MSB first
+ */
+#define TM1629_PLATFORM_SET_SPI_MSB_FIRST(HANDLER, MSB) \
+  (HANDLER)->Platform.SPI.MSBFirst = MSB
+#endif
+
+
+#if (TM1629_CONFIG_ENABLE_TRACE)
+/**
+ * @brief  Link transaction trace hooks to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  BEGIN: Function called before each transaction (can be NULL)
+ * @param  END: Function called after each transaction (can be NULL)
+ */
+#define TM1629_TRACE_LINK_HOOKS(HANDLER, BEGIN, END) \
+  do { (HANDLER)->TraceBegin = BEGIN; (HANDLER)->TraceEnd = END; } while (0)
+
+/**
+ * @brief  Set user context of trace hooks ('Handler->TraceContext')
+ * @param  HANDLER: Pointer to handler
+ * @param  CONTEXT: User pointer
+ */
+#define TM1629_TRACE_SET_CONTEXT(HANDLER, CONTEXT) \
+  (HANDLER)->TraceContext = (void *)(CONTEXT)
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+/**
+ * @brief  Link completion callback of asynchronous flush to handler
+ * @param  HANDLER: Pointer to handler
+ * @param  FUNC: Function name (can be NULL)
+ */
+#define TM1629_ASYNC_LINK_DONE(HANDLER, FUNC) \
+  (HANDLER)->Async.Done = FUNC
+
+/**
+ * @brief  Set user context of completion callback ('Handler->Async.Context')
+ * @param  HANDLER: Pointer to handler
+ * @param  CONTEXT: User pointer
+ */
+#define TM1629_ASYNC_SET_CONTEXT(HANDLER, CONTEXT) \
+  (HANDLER)->Async.Context = (void *)(CONTEXT)
+
+/**
+ * @brief  Check if an asynchronous flush is in progress
+ * @param  HANDLER: Pointer to handler
+ */
+#define TM1629_ASYNC_IS_BUSY(HANDLER) \
+  ((HANDLER)->Async.Busy)
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_BUS)
+/**
+ * @brief  Set context of WriteSTBMask function of the bus
+ * @param  BUS: Pointer to bus
+ * @param  CONTEXT: Pointer passed to WriteSTBMask
+ */
+#define TM1629_BUS_SET_CONTEXT(BUS, CONTEXT) \
+  (BUS)->Context = (void *)(CONTEXT)
+
+/**
+ * @brief  Link function writing several STB pins at once to the bus
+ * @param  BUS: Pointer to bus
+ * @param  FUNC: Function name
+ */
+#define TM1629_BUS_LINK_WRITE_STB_MASK(BUS, FUNC) \
+  (BUS)->WriteSTBMask = FUNC
 #endif
 
-  // Platform dependent layer
-  TM1629_Platform_t Platform;
-} TM1629_Handler_t;
-
 
-/* Exported Macros --------------------------------------------------------------*/
-#if (TM1629_CONFIG_SUPPORT_SPI && TM1629_CONFIG_SUPPORT_GPIO)
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
 /**
- * @brief  Link platform dependent layer communication type
- * @param  HANDLER: Pointer to handler
- * @param  COM: Communication type
- *         - TM1629_COMMUNICATION_GPIO
- *         - TM1629_COMMUNICATION_SPI
- * 
+ * @brief  Set context of platform functions of the wide bus
+ * @param  BUS: Pointer to wide bus
+ * @param  CONTEXT: Pointer passed to platform functions of the bus
  */
-#define TM1629_PLATFORM_SET_COMMUNICATION(HANDLER, COM) \
-  (HANDLER)->Platform.Communication = COM
-#else
-#define TM1629_PLATFORM_SET_COMMUNICATION(HANDLER, COM) \
-  do {} while(0)
-#endif
+#define TM1629_WIDE_BUS_SET_CONTEXT(BUS, CONTEXT) \
+  (BUS)->Context = (void *)(CONTEXT)
 
 /**
- * @brief  Link platform dependent layer functions to handler
- * @param  HANDLER: Pointer to handler
- * @param  FUNC: Function name
+ * @brief  Set CLK pin of the wide bus when it is on the same port as DIO pins
+ * @param  BUS: Pointer to wide bus
+ * @param  MASK: CLK pin on the port
  */
-#define TM1629_PLATFORM_LINK_INIT(HANDLER, FUNC) \
-  (HANDLER)->Platform.Init = FUNC
+#define TM1629_WIDE_BUS_SET_CLK_MASK(BUS, MASK) \
+  (BUS)->CLKMask = MASK
 
 /**
- * @brief  Link platform dependent layer functions to handler
- * @param  HANDLER: Pointer to handler
+ * @brief  Link platform dependent functions to the wide bus
+ * @param  BUS: Pointer to wide bus
  * @param  FUNC: Function name
  */
-#define TM1629_PLATFORM_LINK_DEINIT(HANDLER, FUNC) \
-  (HANDLER)->Platform.DeInit = FUNC
+#define TM1629_WIDE_BUS_LINK_WRITE_STB(BUS, FUNC) \
+  (BUS)->WriteSTB = FUNC
 
 /**
- * @brief  Link platform dependent layer functions to handler
- * @param  HANDLER: Pointer to handler
+ * @brief  Link platform dependent functions to the wide bus
+ * @param  BUS: Pointer to wide bus
  * @param  FUNC: Function name
  */
-#define TM1629_PLATFORM_LINK_WRITE_STB(HANDLER, FUNC) \
-  (HANDLER)->Platform.WriteSTB = FUNC
+#define TM1629_WIDE_BUS_LINK_WRITE_CLK(BUS, FUNC) \
+  (BUS)->WriteCLK = FUNC
 
-#if (TM1629_CONFIG_SUPPORT_GPIO)
 /**
- * @brief  Link platform dependent layer functions to handler
- * @param  HANDLER: Pointer to handler
+ * @brief  Link platform dependent functions to the wide bus
+ * @param  BUS: Pointer to wide bus
  * @param  FUNC: Function name
  */
-#define TM1629_PLATFORM_LINK_DIR_DIO(HANDLER, FUNC) \
-  (HANDLER)->Platform.GPIO.DirDIO = FUNC
+#define TM1629_WIDE_BUS_LINK_DIR_PORT(BUS, FUNC) \
+  (BUS)->DirPort = FUNC
 
 /**
- * @brief  Link platform dependent layer functions to handler
- * @param  HANDLER: Pointer to handler
+ * @brief  Link platform dependent functions to the wide bus
+ * @param  BUS: Pointer to wide bus
  * @param  FUNC: Function name
  */
-#define TM1629_PLATFORM_LINK_WRITE_DIO(HANDLER, FUNC) \
-  (HANDLER)->Platform.GPIO.WriteDIO = FUNC
+#define TM1629_WIDE_BUS_LINK_WRITE_PORT(BUS, FUNC) \
+  (BUS)->WritePort = FUNC
 
 /**
- * @brief  Link platform dependent layer functions to handler
- * @param  HANDLER: Pointer to handler
+ * @brief  Link platform dependent functions to the wide bus
+ * @param  BUS: Pointer to wide bus
  * @param  FUNC: Function name
  */
-
-#define TM1629_PLATFORM_LINK_READ_DIO(HANDLER, FUNC) \
-  (HANDLER)->Platform.GPIO.ReadDIO = FUNC
+#define TM1629_WIDE_BUS_LINK_READ_PORT(BUS, FUNC) \
+  (BUS)->ReadPort = FUNC
 
 /**
- * @brief  Link platform dependent layer functions to handler
- * @param  HANDLER: Pointer to handler
+ * @brief  Link platform dependent functions to the wide bus
+ * @param  BUS: Pointer to wide bus
  * @param  FUNC: Function name
  */
-#define TM1629_PLATFORM_LINK_WRITE_CLK(HANDLER, FUNC) \
-  (HANDLER)->Platform.GPIO.WriteCLK = FUNC
+#define TM1629_WIDE_BUS_LINK_DELAY_US(BUS, FUNC) \
+  (BUS)->DelayUs = FUNC
 
 /**
- * @brief  Link platform dependent layer functions to handler
- * @param  HANDLER: Pointer to handler
+ * @brief  Link platform dependent functions to the wide bus
+ * @param  BUS: Pointer to wide bus
  * @param  FUNC: Function name
  */
-#define TM1629_PLATFORM_LINK_DELAY_US(HANDLER, FUNC) \
-  (HANDLER)->Platform.GPIO.DelayUs = FUNC
+#define TM1629_WIDE_BUS_LINK_DELAY_NS(BUS, FUNC) \
+  (BUS)->DelayNs = FUNC
 #endif
 
 
@@ -349,6 +1557,155 @@ TM1629_Result_t
 TM1629_DeInit(TM1629_Handler_t *Handler);
 
 
+/**
+ * @brief  Forget the cached chip state
+ * @param  Handler: Pointer to handler
+ * @note   The driver does not resend commands which do not change the chip
+ *         state. Call this function if the chip may have lost its state (e.g.
+ *         power cycle), so the next calls send every command again.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_ResetStateCache(TM1629_Handler_t *Handler);
+
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+/**
+ * @brief  Get runtime statistics
+ * @param  Handler: Pointer to handler
+ * @param  Stats: Pointer to save the statistics
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_GetStats(TM1629_Handler_t *Handler, TM1629_Stats_t *Stats);
+
+
+/**
+ * @brief  Reset runtime statistics
+ * @param  Handler: Pointer to handler
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_ResetStats(TM1629_Handler_t *Handler);
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_GPIO)
+/**
+ * @brief  Set bus timing profile of GPIO communication
+ * @param  Handler: Pointer to handler
+ * @param  Timing: Pointer to timing profile
+ * @note   TM1629_Init loads the default profile, so this function must be
+ *         called after TM1629_Init.
+ * @note   Loop counts of a valid calibration are updated for the new profile.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_SetTiming(TM1629_Handler_t *Handler, const TM1629_Timing_t *Timing);
+
+
+/**
+ * @brief  Get number of DIO direction switches avoided by direction caching
+ * @param  Handler: Pointer to handler
+ * @param  Count: Pointer to save the number of avoided switches
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_GetDirDIOSkipped(TM1629_Handler_t *Handler, uint32_t *Count);
+
+
+#if (TM1629_CONFIG_ENABLE_CALIBRATION)
+/**
+ * @brief  Measure the cost of pin write calls and of the busy-wait loop, and
+ *         replace the delays of the timing profile with the smallest loop
+ *         counts that still meet it
+ * @param  Handler: Pointer to handler
+ * @note   TM1629_Init calls this function when GetTimeNs is linked. Call it
+ *         again if the CPU clock changes.
+ * @note   CLK is held high and STB is not touched, so the chip ignores the
+ *         measurement.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ *         - TM1629_FAIL: GetTimeNs is not linked, the clock does not advance or an
+ *                        asynchronous flush is in progress.
+ */
+TM1629_Result_t
+TM1629_Calibrate(TM1629_Handler_t *Handler);
+#endif
+#endif
+
+
+
+#if (TM1629_CONFIG_SUPPORT_BUS)
+/**
+ * @brief  Initialize shared bus
+ * @param  Bus: Pointer to bus
+ * @note   Context and WriteSTBMask are not touched.
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ */
+TM1629_Result_t
+TM1629_Bus_Init(TM1629_Bus_t *Bus);
+
+
+/**
+ * @brief  Attach handler to shared bus
+ * @param  Bus: Pointer to bus
+ * @param  Handler: Pointer to handler
+ * @param  Index: Pointer to save index of the handler on the bus (bit of the
+ *                handler in masks). It can be NULL.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ *         - TM1629_FAIL: Bus is full.
+ */
+TM1629_Result_t
+TM1629_Bus_Attach(TM1629_Bus_t *Bus, TM1629_Handler_t *Handler, uint8_t *Index);
+#endif
+
+
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Initialize wide bus
+ * @param  Bus: Pointer to wide bus
+ * @note   Platform functions, Context and CLKMask must be set before.
+ * @note   Timing is loaded with the default profile and can be changed
+ *         afterwards.
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ *         - TM1629_FAIL: Needed platform functions are not linked.
+ */
+TM1629_Result_t
+TM1629_WideBus_Init(TM1629_WideBus_t *Bus);
+
+
+/**
+ * @brief  Attach handler to wide bus
+ * @param  Bus: Pointer to wide bus
+ * @param  Handler: Pointer to handler. It must be initialized by TM1629_Init.
+ * @param  DIOMask: DIO pin of the chip on the port (one bit)
+ * @param  Index: Pointer to save index of the handler on the bus. It can be
+ *                NULL.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful.
+ *         - TM1629_FAIL: Bus is full or DIOMask is invalid.
+ */
+TM1629_Result_t
+TM1629_WideBus_Attach(TM1629_WideBus_t *Bus, TM1629_Handler_t *Handler,
+                      uint32_t DIOMask, uint8_t *Index);
+#endif
+
+
 
 /**
  ==================================================================================
@@ -375,6 +1732,7 @@ TM1629_DeInit(TM1629_Handler_t *Handler);
  * 
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: An asynchronous flush is in progress
  */
 TM1629_Result_t
 TM1629_ConfigDisplay(TM1629_Handler_t *Handler,
@@ -508,6 +1866,219 @@ TM1629_SetMultipleDigit_CHAR(TM1629_Handler_t *Handler, const char *Str,
 
 
 
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+/**
+ * @brief  Enable or disable buffered mode
+ * @param  Handler: Pointer to handler
+ * @param  Enable: Buffered mode state
+ *         - 0: Display functions send data to the chip immediately
+ *         - 1: Display functions only update the shadow of display RAM and the
+ *              changes are sent by TM1629_Flush
+ * @note   Disabling buffered mode flushes the pending changes.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to flush the pending changes
+ */
+TM1629_Result_t
+TM1629_SetBufferedMode(TM1629_Handler_t *Handler, uint8_t Enable);
+
+
+/**
+ * @brief  Send changed bytes of the shadow of display RAM to the chip
+ * @param  Handler: Pointer to handler
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data
+ */
+TM1629_Result_t
+TM1629_Flush(TM1629_Handler_t *Handler);
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC)
+/**
+ * @brief  Queue changed bytes of the shadow of display RAM and return without
+ *         sending them
+ * @param  Handler: Pointer to handler
+ * @note   The queued bytes are copied, so the shadow can be changed while the
+ *         flush is in progress. TM1629_Poll sends them and calls the
+ *         completion callback at the end. Nothing is queued (and the callback
+ *         is not called) if no byte is changed.
+ * @note   While the flush is in progress (TM1629_ASYNC_IS_BUSY), other
+ *         functions that communicate with the chip, or with another chip
+ *         attached to the same shared bus, return TM1629_FAIL and display
+ *         functions only update the shadow.
+ * @note   In timer mode (TimerStart and TimerStop are linked), the timer is
+ *         started here and TM1629_TimerTick sends the bytes instead of
+ *         TM1629_Poll.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Another flush is in progress (also on the bus), the
+ *                        handler does not use GPIO communication or the
+ *                        timer did not start
+ */
+TM1629_Result_t
+TM1629_FlushAsync(TM1629_Handler_t *Handler);
+
+
+/**
+ * @brief  Advance asynchronous flush
+ * @param  Handler: Pointer to handler
+ * @param  MaxEdges: Most STB/CLK edges generated by this call. Each edge
+ *                   also waits for its delay of the timing profile, so the
+ *                   call takes about MaxEdges * 1 us with the default
+ *                   profile.
+ * @note   It does nothing while the flush is driven by the timer.
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful (also when idle)
+ *         - TM1629_FAIL: A platform function failed and the flush is aborted
+ */
+TM1629_Result_t
+TM1629_Poll(TM1629_Handler_t *Handler, uint16_t MaxEdges);
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_TIMER)
+/**
+ * @brief  Make the next edge of the flush started by TM1629_FlushAsync
+ * @param  Handler: Pointer to handler
+ * @note   Call it from the interrupt of the timer started by TimerStart. Each
+ *         call makes at most one STB or CLK edge without any delay, so the
+ *         timer period is the only timing. The period passed to TimerStart is
+ *         the largest of ClockHighNs, ClockLowNs and StrobeNs of the timing
+ *         profile.
+ * @note   The timer is stopped and the completion callback is called from
+ *         this function after the last edge.
+ * @retval None
+ */
+void
+TM1629_TimerTick(TM1629_Handler_t *Handler);
+#endif
+
+
+#if (TM1629_SUPPORT_SHADOW)
+/**
+ * @brief  Compute the cheapest sequence of transactions sending the dirty bytes
+ *         of the shadow of display RAM, without sending anything
+ * @param  Handler: Pointer to handler
+ * @param  Plan: Pointer to save the plan
+ * @note   Only auto-increment bursts are planned. A burst may cover clean
+ *         bytes between dirty ones when that is cheaper than starting another
+ *         transaction. A fixed address write costs the same as a burst of one
+ *         byte, so fixed address mode is never cheaper.
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ */
+TM1629_Result_t
+TM1629_PlanFlush(const TM1629_Handler_t *Handler, TM1629_FlushPlan_t *Plan);
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_BUS)
+/**
+ * @brief  Config display parameters of several chips in one transaction
+ * @param  Bus: Pointer to bus
+ * @param  Mask: Selected chips (bit n => n-th handler attached to the bus)
+ * @param  Brightness: Set brightness level (see TM1629_ConfigDisplay)
+ * @param  DisplayState: Set display ON or OFF (see TM1629_ConfigDisplay)
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data or an asynchronous flush is in
+ *           progress
+ */
+TM1629_Result_t
+TM1629_Bus_ConfigDisplay(TM1629_Bus_t *Bus, uint32_t Mask,
+                         uint8_t Brightness, uint8_t DisplayState);
+
+
+/**
+ * @brief  Clear whole display RAM of several chips in one transaction
+ * @param  Bus: Pointer to bus
+ * @param  Mask: Selected chips (bit n => n-th handler attached to the bus)
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data or an asynchronous flush is in
+ *           progress
+ */
+TM1629_Result_t
+TM1629_Bus_Clear(TM1629_Bus_t *Bus, uint32_t Mask);
+#endif
+
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Config display parameters of all chips on the wide bus
+ * @param  Bus: Pointer to wide bus
+ * @param  Brightness: Set brightness level (see TM1629_ConfigDisplay)
+ * @param  DisplayState: Set display ON or OFF (see TM1629_ConfigDisplay)
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data or an asynchronous flush is in
+ *           progress
+ */
+TM1629_Result_t
+TM1629_WideBus_ConfigDisplay(TM1629_WideBus_t *Bus,
+                             uint8_t Brightness, uint8_t DisplayState);
+
+
+/**
+ * @brief  Send display RAM shadow of all chips on the wide bus in parallel
+ * @note   The address range covering the dirty bytes of all chips is sent
+ *         in one transaction.
+ * @param  Bus: Pointer to wide bus
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to send data or an asynchronous flush is in
+ *           progress
+ */
+TM1629_Result_t
+TM1629_WideBus_Flush(TM1629_WideBus_t *Bus);
+#endif
+
+
+
+/**
+ ==================================================================================
+                          ##### Conversion Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Convert hexadecimal digits to 7-segment format
+ * @param  Hex: Array of digits (0, 1, ... , 15, a, A, b, B, ... , f, F). Set
+ *              'TM1629_DECIMAL_POINT' bit of a digit to turn its DP on.
+ * @param  Data: Array to save 7-segment codes (unsupported digits => 0)
+ * @param  Count: Number of digits to convert
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Invalid arguments
+ */
+TM1629_Result_t
+TM1629_HexTo7Seg(const uint8_t *Hex, uint8_t *Data, uint8_t Count);
+
+
+/**
+ * @brief  Convert characters to 7-segment format
+ * @param  Str: Array of characters
+ *              Supported chars 0,1,2,3,4,5,6,7,8,9
+ *                              A,b,C,d,E,F,g,G,h,H,i,I,j,l,L,n,N,o,O,P,q,r,S,
+ *                              t,u,U,y,_,-,Overscore (use ~ to set),
+ *                              . (only decimal point)
+ *              Set 'TM1629_DECIMAL_POINT' bit of a char to turn its DP on.
+ * @param  Data: Array to save 7-segment codes (unsupported chars => 0)
+ * @param  Count: Number of characters to convert
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Invalid arguments
+ */
+TM1629_Result_t
+TM1629_StringTo7Seg(const char *Str, uint8_t *Data, uint8_t Count);
+
+
+
 /** 
  ==================================================================================
                            ##### Keypad Functions #####                            
@@ -533,11 +2104,29 @@ TM1629_SetMultipleDigit_CHAR(TM1629_Handler_t *Handler, const char *Str,
  * 
  * @retval TM1629_Result_t
  *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: An asynchronous flush is in progress
  */
 TM1629_Result_t
 TM1629_ScanKeys(TM1629_Handler_t *Handler, uint32_t *Keys);
 
 
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Scan keys of all chips on the wide bus in parallel
+ * @param  Bus: Pointer to wide bus
+ * @param  Keys: Pointer to array to save key scan result of each attached
+ *               handler (see TM1629_ScanKeys)
+ *
+ * @retval TM1629_Result_t
+ *         - TM1629_OK: Operation was successful
+ *         - TM1629_FAIL: Failed to read data or an asynchronous flush is in
+ *           progress
+ */
+TM1629_Result_t
+TM1629_WideBus_ScanKeys(TM1629_WideBus_t *Bus, uint32_t *Keys);
+#endif
+
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,647 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_benchmark.c
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Bus cost benchmark of TM1629 Driver (host side, Linux)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ *
+ * Runs the public API in both display types against the simulated TM1629 of
+ * port/Linux-Simulator and prints per-call costs as JSON. When a budget file
+ * is given, the program fails (exit code 1) if a result exceeds its budget or
+ * has no budget.
+ * The flush planner is also checked against known dirty masks: the planned
+ * writes, the transactions and bytes seen by the simulator and the resulting
+ * display RAM must all match. Other checks run the driver on several
+ * simulated chips (e.g. a shared bus) and print pass or fail.
+ *
+ * Build and run from the root of the repository:
+ *   gcc -O2 -Iconfig -Isrc/include -Iport/Linux-Simulator src/TM1629.c \
+ *       port/Linux-Simulator/TM1629_platform.c \
+ *       tools/Benchmark/TM1629_benchmark.c -o TM1629_benchmark
+ *   ./TM1629_benchmark tools/Benchmark/TM1629_budget.txt > result.json
+ *
+ **********************************************************************************
+ */
+
+/* Includes ---------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "TM1629.h"
+#include "TM1629_platform.h"
+
+
+/* Private Constants ------------------------------------------------------------*/
+/**
+ * @brief  Number of calls of each operation (results are per call)
+ */
+#define BENCHMARK_ITERATIONS  256
+
+#define BENCHMARK_MAX_BUDGETS 64
+#define BENCHMARK_NAME_SIZE   64
+
+/**
+ * @brief  Simulated chips of the wide bus check
+ */
+#define BENCHMARK_WIDE_BUS_CHIPS  3
+
+
+
+/* Private Data Types -----------------------------------------------------------*/
+typedef void (*Benchmark_Op_t)(TM1629_Handler_t *Handler, uint32_t Iteration);
+
+typedef struct Benchmark_Case_s
+{
+  const char *Name;
+  Benchmark_Op_t Op;
+} Benchmark_Case_t;
+
+typedef struct Benchmark_Result_s
+{
+  double Calls;
+  double Transactions;
+  double EdgesCLK;
+  double Bytes;
+  double BusTimeNs;
+  double CpuNs;
+} Benchmark_Result_t;
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+typedef struct Benchmark_PlanCase_s
+{
+  const char *Name;
+  uint16_t DirtyMask;
+  uint8_t NumOfWrites;
+  struct
+  {
+    uint8_t Addr;
+    uint8_t Count;
+  } Writes[16];
+} Benchmark_PlanCase_t;
+#endif
+
+typedef struct Benchmark_Check_s
+{
+  const char *Name;
+  int (*Run)(void);
+} Benchmark_Check_t;
+
+typedef struct Benchmark_Budget_s
+{
+  char Name[BENCHMARK_NAME_SIZE];
+  double Calls;
+  double Transactions;
+  double EdgesCLK;
+  double Bytes;
+} Benchmark_Budget_t;
+
+
+
+/**
+ ==================================================================================
+                                ##### Operations #####
+ ==================================================================================
+ */
+
+// Each call changes the displayed data, so no call is skipped by the driver
+
+static void
+Benchmark_SetSingleDigit(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  TM1629_SetSingleDigit(Handler, (Iteration & 0x7F) | 0x01, Iteration & 0x0F);
+}
+
+static void
+Benchmark_SetSingleDigit_HEX(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  TM1629_SetSingleDigit_HEX(Handler, Iteration & 0x0F, (Iteration >> 4) & 0x0F);
+}
+
+static void
+Benchmark_SetSingleDigit_CHAR(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  TM1629_SetSingleDigit_CHAR(Handler, '0' + (Iteration % 10), Iteration & 0x0F);
+}
+
+static void
+Benchmark_SetMultipleDigit(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  uint8_t DigitData[16];
+
+  for (uint8_t i = 0; i < 16; i++)
+    DigitData[i] = (uint8_t)(Iteration + i) | 0x01;
+  TM1629_SetMultipleDigit(Handler, DigitData, 0, 16);
+}
+
+static void
+Benchmark_SetMultipleDigit_HEX(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  uint8_t DigitData[16];
+
+  for (uint8_t i = 0; i < 16; i++)
+    DigitData[i] = (uint8_t)(Iteration + i) & 0x0F;
+  TM1629_SetMultipleDigit_HEX(Handler, DigitData, 0, 16);
+}
+
+static void
+Benchmark_SetMultipleDigit_CHAR(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  char Str[17];
+
+  for (uint8_t i = 0; i < 16; i++)
+    Str[i] = 'A' + (char)((Iteration + i) % 26);
+  Str[16] = '\0';
+  TM1629_SetMultipleDigit_CHAR(Handler, Str, 0, 16);
+}
+
+static void
+Benchmark_ConfigDisplay(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  TM1629_ConfigDisplay(Handler, Iteration & 0x07, TM1629_DISPLAY_STATE_ON);
+}
+
+static void
+Benchmark_ScanKeys(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  uint32_t Keys = 0;
+
+  (void)Iteration;
+  TM1629_ScanKeys(Handler, &Keys);
+}
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+static void
+Benchmark_Flush(TM1629_Handler_t *Handler, uint32_t Iteration)
+{
+  TM1629_SetBufferedMode(Handler, 1);
+  TM1629_SetSingleDigit(Handler, (Iteration & 0x7F) | 0x01, 1);
+  TM1629_SetSingleDigit(Handler, (Iteration & 0x7F) | 0x02, 2);
+  TM1629_SetSingleDigit(Handler, (Iteration & 0x7F) | 0x04, 9);
+  TM1629_Flush(Handler);
+  TM1629_SetBufferedMode(Handler, 0);
+}
+#endif
+
+static const Benchmark_Case_t Benchmark_Cases[] =
+{
+  {"SetSingleDigit",        Benchmark_SetSingleDigit},
+  {"SetSingleDigit_HEX",    Benchmark_SetSingleDigit_HEX},
+  {"SetSingleDigit_CHAR",   Benchmark_SetSingleDigit_CHAR},
+  {"SetMultipleDigit",      Benchmark_SetMultipleDigit},
+  {"SetMultipleDigit_HEX",  Benchmark_SetMultipleDigit_HEX},
+  {"SetMultipleDigit_CHAR", Benchmark_SetMultipleDigit_CHAR},
+  {"ConfigDisplay",         Benchmark_ConfigDisplay},
+  {"ScanKeys",              Benchmark_ScanKeys},
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+  {"Flush",                 Benchmark_Flush},
+#endif
+};
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+// Expected writes with the default 'TM1629_CONFIG_TRANSACTION_COST'
+static const Benchmark_PlanCase_t Benchmark_PlanCases[] =
+{
+  {"Empty",     0x0000, 0, {{0, 0}}},
+  {"Adjacent",  0x00F0, 1, {{4, 4}}},
+  {"Scattered", 0x8101, 3, {{0, 1}, {8, 1}, {15, 1}}},
+  {"Gap",       0x0014, 1, {{2, 3}}},
+  {"All",       0xFFFF, 1, {{0, 16}}},
+};
+#endif
+
+static const char *const Benchmark_DisplayTypes[] =
+{
+  "COM_CATHODE",
+  "COM_ANODE",
+};
+
+
+
+/**
+ ==================================================================================
+                           ##### Private Functions #####
+ ==================================================================================
+ */
+
+static double
+Benchmark_NowNs(void)
+{
+  struct timespec Now;
+
+  clock_gettime(CLOCK_MONOTONIC, &Now);
+  return (double)Now.tv_sec * 1e9 + (double)Now.tv_nsec;
+}
+
+static int
+Benchmark_Run(TM1629_DisplayType_t Type, const Benchmark_Case_t *Case,
+              Benchmark_Result_t *Result)
+{
+  TM1629_Handler_t Handler = {0};
+  TM1629_Sim_t Sim;
+  double Start = 0;
+
+  TM1629_Sim_Reset(&Sim);
+  TM1629_Platform_Init_Sim(&Handler, &Sim);
+  if (TM1629_Init(&Handler, Type) != TM1629_OK)
+    return -1;
+
+  // Warm up: the state caches of the driver reach the steady state
+  TM1629_ConfigDisplay(&Handler, 7, TM1629_DISPLAY_STATE_ON);
+  Case->Op(&Handler, BENCHMARK_ITERATIONS);
+  TM1629_Sim_ResetStats(&Sim);
+
+  Start = Benchmark_NowNs();
+  for (uint32_t i = 0; i < BENCHMARK_ITERATIONS; i++)
+    Case->Op(&Handler, i);
+  Result->CpuNs = (Benchmark_NowNs() - Start) / BENCHMARK_ITERATIONS;
+
+  if (Sim.Errors)
+    return -1;
+
+  Result->Calls = (double)Sim.Calls / BENCHMARK_ITERATIONS;
+  Result->Transactions = (double)Sim.Transactions / BENCHMARK_ITERATIONS;
+  Result->EdgesCLK = (double)Sim.EdgesCLK / BENCHMARK_ITERATIONS;
+  Result->Bytes = (double)(Sim.BytesWritten + Sim.BytesRead) / BENCHMARK_ITERATIONS;
+  Result->BusTimeNs = (double)Sim.TimeNs / BENCHMARK_ITERATIONS;
+
+  return 0;
+}
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+static int
+Benchmark_CheckPlan(const Benchmark_PlanCase_t *Case, TM1629_FlushPlan_t *Plan)
+{
+  TM1629_Handler_t Handler = {0};
+  TM1629_Sim_t Sim;
+  uint32_t Bytes = 0;
+
+  TM1629_Sim_Reset(&Sim);
+  TM1629_Platform_Init_Sim(&Handler, &Sim);
+  if (TM1629_Init(&Handler, TM1629_DISPLAY_TYPE_COM_CATHODE) != TM1629_OK)
+    return -1;
+
+  for (uint8_t i = 0; i < 16; i++)
+  {
+    if (Case->DirtyMask & (1 << i))
+      Handler.DisplayRegister[i] = 0x5A ^ i;
+  }
+  Handler.DirtyMask = Case->DirtyMask;
+
+  if (TM1629_PlanFlush(&Handler, Plan) != TM1629_OK ||
+      Plan->NumOfWrites != Case->NumOfWrites)
+    return -1;
+
+  for (uint8_t i = 0; i < Plan->NumOfWrites; i++)
+  {
+    if (Plan->Writes[i].Addr != Case->Writes[i].Addr ||
+        Plan->Writes[i].Count != Case->Writes[i].Count)
+      return -1;
+    Bytes += Plan->Writes[i].Count + 1;
+  }
+  Bytes += Plan->SendDataCommand;
+
+  TM1629_Sim_ResetStats(&Sim);
+  if (TM1629_Flush(&Handler) != TM1629_OK || Sim.Errors)
+    return -1;
+
+  // The simulator must see exactly the planned transactions
+  if (Sim.Transactions != (uint32_t)Plan->NumOfWrites + Plan->SendDataCommand ||
+      Sim.BytesWritten != Bytes ||
+      Plan->Cost != Sim.Transactions * TM1629_CONFIG_TRANSACTION_COST + 8 * Bytes)
+    return -1;
+
+  if (memcmp(Sim.DisplayRAM, Handler.DisplayRegister, sizeof(Sim.DisplayRAM)))
+    return -1;
+
+  return 0;
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_ASYNC && TM1629_CONFIG_SUPPORT_BUS && \
+     TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+/**
+ * @brief  An asynchronous flush of one chip on a shared bus blocks the others
+ */
+static int
+Benchmark_CheckBusAsync(void)
+{
+  TM1629_Handler_t Handler[2] = {0};
+  TM1629_Sim_t Sim[2];
+  TM1629_Bus_t Bus = {0};
+  uint32_t Keys = 0;
+
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    TM1629_Sim_Reset(&Sim[i]);
+    TM1629_Platform_Init_Sim(&Handler[i], &Sim[i]);
+    if (TM1629_Init(&Handler[i], TM1629_DISPLAY_TYPE_COM_CATHODE) != TM1629_OK)
+      return -1;
+  }
+
+  TM1629_Bus_Init(&Bus);
+  TM1629_Bus_Attach(&Bus, &Handler[0], NULL);
+  TM1629_Bus_Attach(&Bus, &Handler[1], NULL);
+
+  memset(Handler[0].DisplayRegister, 0x5A, sizeof(Handler[0].DisplayRegister));
+  Handler[0].DirtyMask = 0xFFFF;
+  memset(Handler[1].DisplayRegister, 0xA5, sizeof(Handler[1].DisplayRegister));
+  Handler[1].DirtyMask = 0xFFFF;
+
+  // Leave the first chip in the middle of a frame
+  if (TM1629_FlushAsync(&Handler[0]) != TM1629_OK ||
+      TM1629_Poll(&Handler[0], 5) != TM1629_OK ||
+      !TM1629_ASYNC_IS_BUSY(&Handler[0]))
+    return -1;
+
+  TM1629_Sim_ResetStats(&Sim[1]);
+  if (TM1629_ScanKeys(&Handler[1], &Keys) != TM1629_FAIL ||
+      TM1629_ConfigDisplay(&Handler[1], 3, TM1629_DISPLAY_STATE_ON) != TM1629_FAIL ||
+      TM1629_FlushAsync(&Handler[1]) != TM1629_FAIL ||
+      TM1629_Flush(&Handler[1]) != TM1629_FAIL ||
+      Sim[1].Transactions)
+    return -1;
+
+  while (TM1629_ASYNC_IS_BUSY(&Handler[0]))
+  {
+    if (TM1629_Poll(&Handler[0], 64) != TM1629_OK)
+      return -1;
+  }
+
+  // The bus is free again
+  if (TM1629_ScanKeys(&Handler[1], &Keys) != TM1629_OK ||
+      TM1629_Flush(&Handler[1]) != TM1629_OK ||
+      Sim[0].Errors || Sim[1].Errors ||
+      memcmp(Sim[0].DisplayRAM, Handler[0].DisplayRegister, 16) ||
+      memcmp(Sim[1].DisplayRAM, Handler[1].DisplayRegister, 16))
+    return -1;
+
+  return 0;
+}
+#endif
+
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+/**
+ * @brief  Chips on a wide bus get their own display RAM and keys, with CLK
+ *         written by WriteCLK (CLKMask = 0) or on the port
+ */
+static int
+Benchmark_CheckWideBusPort(uint32_t CLKMask)
+{
+  static const uint32_t PressedKeys[BENCHMARK_WIDE_BUS_CHIPS] =
+  {
+    0x00000001, 0x80000000, 0x00F000F0,
+  };
+  TM1629_Handler_t Handler[BENCHMARK_WIDE_BUS_CHIPS] = {0};
+  TM1629_Sim_t Sim[BENCHMARK_WIDE_BUS_CHIPS];
+  TM1629_WideBus_t Bus = {0};
+  TM1629_Sim_WideBus_t Port;
+  uint32_t Keys[BENCHMARK_WIDE_BUS_CHIPS] = {0};
+
+  if (TM1629_Platform_Init_Sim_WideBus(&Bus, &Port, CLKMask) < 0)
+    return -1;
+
+  for (uint8_t i = 0; i < BENCHMARK_WIDE_BUS_CHIPS; i++)
+  {
+    TM1629_Sim_Reset(&Sim[i]);
+    TM1629_Platform_Init_Sim(&Handler[i], &Sim[i]);
+    if (TM1629_Init(&Handler[i], TM1629_DISPLAY_TYPE_COM_CATHODE) != TM1629_OK ||
+        TM1629_Platform_Attach_Sim_WideBus(&Bus, &Handler[i], &Sim[i],
+                                           0x02u << i) < 0)
+      return -1;
+
+    for (uint8_t j = 0; j < 16; j++)
+      Handler[i].DisplayRegister[j] = (uint8_t)(0x11 * i + j);
+    Handler[i].DirtyMask = 0xFFFF;
+    TM1629_Sim_SetKeys(&Sim[i], PressedKeys[i]);
+  }
+
+  if (TM1629_WideBus_ConfigDisplay(&Bus, 5, TM1629_DISPLAY_STATE_ON) != TM1629_OK ||
+      TM1629_WideBus_Flush(&Bus) != TM1629_OK)
+    return -1;
+
+  // Only one chip is dirty, the others get their own bytes again
+  Handler[1].DisplayRegister[7] = 0xFF;
+  Handler[1].DirtyMask = 1u << 7;
+  if (TM1629_WideBus_Flush(&Bus) != TM1629_OK ||
+      TM1629_WideBus_ScanKeys(&Bus, Keys) != TM1629_OK)
+    return -1;
+
+  for (uint8_t i = 0; i < BENCHMARK_WIDE_BUS_CHIPS; i++)
+  {
+    if (Sim[i].Errors || TM1629_Sim_GetBrightness(&Sim[i]) != 5 ||
+        Keys[i] != PressedKeys[i] ||
+        memcmp(Sim[i].DisplayRAM, Handler[i].DisplayRegister, 16))
+      return -1;
+  }
+
+  return 0;
+}
+
+static int
+Benchmark_CheckWideBus(void)
+{
+  if (Benchmark_CheckWideBusPort(0) < 0 ||
+      Benchmark_CheckWideBusPort(0x01) < 0)
+    return -1;
+
+  return 0;
+}
+#endif
+
+/**
+ * @brief  Load budget file
+ * @note   Each line: <display type>/<operation> <calls> <transactions>
+ *         <clock edges> <bytes>. Lines starting with '#' are ignored.
+ */
+static int
+Benchmark_LoadBudgets(const char *Path, Benchmark_Budget_t *Budgets)
+{
+  FILE *File = fopen(Path, "r");
+  char Line[256];
+  int NumOfBudgets = 0;
+
+  if (!File)
+    return -1;
+
+  while (fgets(Line, sizeof(Line), File) && NumOfBudgets < BENCHMARK_MAX_BUDGETS)
+  {
+    Benchmark_Budget_t *Budget = &Budgets[NumOfBudgets];
+
+    if (Line[0] == '#')
+      continue;
+
+    if (sscanf(Line, "%63s %lf %lf %lf %lf", Budget->Name, &Budget->Calls,
+               &Budget->Transactions, &Budget->EdgesCLK, &Budget->Bytes) == 5)
+      NumOfBudgets++;
+  }
+
+  fclose(File);
+  return NumOfBudgets;
+}
+
+static const Benchmark_Budget_t *
+Benchmark_FindBudget(const Benchmark_Budget_t *Budgets, int NumOfBudgets,
+                     const char *Name)
+{
+  for (int i = 0; i < NumOfBudgets; i++)
+  {
+    if (!strcmp(Budgets[i].Name, Name))
+      return &Budgets[i];
+  }
+
+  return NULL;
+}
+
+static int
+Benchmark_CheckBudget(const Benchmark_Budget_t *Budget,
+                      const Benchmark_Result_t *Result)
+{
+  // Per-call results are averages, allow rounding of the budget file
+  const double Epsilon = 0.005;
+
+  // Without a budget file nothing is checked (missing entries fail in main)
+  if (!Budget)
+    return 0;
+
+  return (Result->Calls > Budget->Calls + Epsilon) ||
+         (Result->Transactions > Budget->Transactions + Epsilon) ||
+         (Result->EdgesCLK > Budget->EdgesCLK + Epsilon) ||
+         (Result->Bytes > Budget->Bytes + Epsilon);
+}
+
+
+
+static const Benchmark_Check_t Benchmark_Checks[] =
+{
+#if (TM1629_CONFIG_SUPPORT_ASYNC && TM1629_CONFIG_SUPPORT_BUS && \
+     TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+  {"BusAsync", Benchmark_CheckBusAsync},
+#endif
+#if (TM1629_CONFIG_SUPPORT_WIDE_BUS)
+  {"WideBus", Benchmark_CheckWideBus},
+#endif
+  {NULL, NULL},
+};
+
+
+
+/**
+ ==================================================================================
+                                  ##### Main #####
+ ==================================================================================
+ */
+
+int
+main(int argc, char *argv[])
+{
+  Benchmark_Budget_t Budgets[BENCHMARK_MAX_BUDGETS];
+  int NumOfBudgets = 0;
+  int NumOfFailures = 0;
+  int First = 1;
+
+  if (argc > 1)
+  {
+    NumOfBudgets = Benchmark_LoadBudgets(argv[1], Budgets);
+    if (NumOfBudgets < 0)
+    {
+      fprintf(stderr, "Can not open budget file '%s'\n", argv[1]);
+      return 2;
+    }
+  }
+
+  printf("{\n  \"iterations\": %d,\n  \"results\": [\n", BENCHMARK_ITERATIONS);
+
+  for (uint8_t Type = 0; Type < 2; Type++)
+  {
+    for (size_t i = 0; i < sizeof(Benchmark_Cases) / sizeof(Benchmark_Cases[0]); i++)
+    {
+      const Benchmark_Case_t *Case = &Benchmark_Cases[i];
+      Benchmark_Result_t Result = {0};
+      char Name[BENCHMARK_NAME_SIZE];
+      const Benchmark_Budget_t *Budget = NULL;
+      int Failed = 0;
+      int Error = 0;
+
+      snprintf(Name, sizeof(Name), "%s/%s", Benchmark_DisplayTypes[Type], Case->Name);
+      Error = Benchmark_Run((TM1629_DisplayType_t)Type, Case, &Result);
+      Budget = Benchmark_FindBudget(Budgets, NumOfBudgets, Name);
+      if (argc > 1 && !Budget)
+      {
+        fprintf(stderr, "No budget for '%s' in '%s'\n", Name, argv[1]);
+        Failed = 1;
+      }
+      Failed = Failed || Error || Benchmark_CheckBudget(Budget, &Result);
+      NumOfFailures += Failed;
+
+      printf("%s    {\"name\": \"%s\", \"calls\": %.2f, \"transactions\": %.2f, "
+             "\"clk_edges\": %.2f, \"bytes\": %.2f, \"bus_time_ns\": %.0f, "
+             "\"cpu_ns\": %.1f, \"budget\": %s, \"error\": %s, \"pass\": %s}",
+             First ? "" : ",\n", Name, Result.Calls, Result.Transactions,
+             Result.EdgesCLK, Result.Bytes, Result.BusTimeNs, Result.CpuNs,
+             Budget ? "true" : "false", Error ? "true" : "false",
+             Failed ? "false" : "true");
+      First = 0;
+    }
+  }
+
+  printf("\n  ],\n");
+
+#if (TM1629_CONFIG_SUPPORT_BUFFERED_MODE)
+  printf("  \"planner\": [\n");
+  First = 1;
+  for (size_t i = 0; i < sizeof(Benchmark_PlanCases) / sizeof(Benchmark_PlanCases[0]); i++)
+  {
+    TM1629_FlushPlan_t Plan = {0};
+    int Failed = (Benchmark_CheckPlan(&Benchmark_PlanCases[i], &Plan) != 0);
+
+    NumOfFailures += Failed;
+    printf("%s    {\"name\": \"%s\", \"dirty_mask\": \"0x%04X\", \"writes\": %u, "
+           "\"cost\": %u, \"pass\": %s}",
+           First ? "" : ",\n", Benchmark_PlanCases[i].Name,
+           Benchmark_PlanCases[i].DirtyMask, Plan.NumOfWrites, Plan.Cost,
+           Failed ? "false" : "true");
+    First = 0;
+  }
+  printf("\n  ],\n");
+#endif
+
+  printf("  \"checks\": [\n");
+  First = 1;
+  for (const Benchmark_Check_t *Check = Benchmark_Checks; Check->Name; Check++)
+  {
+    int Failed = (Check->Run() != 0);
+
+    NumOfFailures += Failed;
+    printf("%s    {\"name\": \"%s\", \"pass\": %s}",
+           First ? "" : ",\n", Check->Name, Failed ? "false" : "true");
+    First = 0;
+  }
+  printf("\n  ],\n");
+
+  printf("  \"failures\": %d\n}\n", NumOfFailures);
+
+  return NumOfFailures ? 1 : 0;
+}
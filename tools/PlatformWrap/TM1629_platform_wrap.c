@@ -0,0 +1,233 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_platform_wrap.c
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Platform layer wrapper reporting pin changes of a handler (host side)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629_platform_wrap.h"
+#include <string.h>
+
+
+/* Private Constants ------------------------------------------------------------*/
+/**
+ * @brief  Longest delay (us) passed to DelayNs at once
+ */
+#define PLATFORM_WRAP_MAX_DELAY_NS_US  65
+
+
+/* Private Macros ---------------------------------------------------------------*/
+#define TM1629_PLATFORM_WRAP(CONTEXT)  ((TM1629_PlatformWrap_t *)(CONTEXT))
+#define TM1629_PLATFORM_WRAP_INNER(WRAP)  TM1629_PLATFORM_OPS(&(WRAP)->Inner)
+
+
+
+/**
+ ==================================================================================
+                           ##### Private Functions #####
+ ==================================================================================
+ */
+
+static int8_t
+TM1629_PlatformWrap_Init(void *Context)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  if (!TM1629_PLATFORM_WRAP_INNER(Wrap)->Init)
+    return 0;
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->Init(Wrap->Inner.Context);
+}
+
+static int8_t
+TM1629_PlatformWrap_DeInit(void *Context)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  if (!TM1629_PLATFORM_WRAP_INNER(Wrap)->DeInit)
+    return 0;
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->DeInit(Wrap->Inner.Context);
+}
+
+static int8_t
+TM1629_PlatformWrap_WriteSTB(void *Context, uint8_t State)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  Wrap->Edge(Wrap->EdgeContext, TM1629_PLATFORM_WRAP_SIGNAL_STB, State);
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->WriteSTB(Wrap->Inner.Context, State);
+}
+
+static int8_t
+TM1629_PlatformWrap_WriteCLK(void *Context, uint8_t State)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  Wrap->Edge(Wrap->EdgeContext, TM1629_PLATFORM_WRAP_SIGNAL_CLK, State);
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.WriteCLK(Wrap->Inner.Context, State);
+}
+
+static int8_t
+TM1629_PlatformWrap_WriteDIO(void *Context, uint8_t State)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  Wrap->Edge(Wrap->EdgeContext, TM1629_PLATFORM_WRAP_SIGNAL_DIO, State);
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.WriteDIO(Wrap->Inner.Context, State);
+}
+
+static int8_t
+TM1629_PlatformWrap_ReadDIO(void *Context)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+  int8_t Result = TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.ReadDIO(Wrap->Inner.Context);
+
+  if (Result >= 0)
+    Wrap->Edge(Wrap->EdgeContext, TM1629_PLATFORM_WRAP_SIGNAL_DIO_READ, Result);
+  return Result;
+}
+
+static int8_t
+TM1629_PlatformWrap_DirDIO(void *Context, uint8_t Dir)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  Wrap->Edge(Wrap->EdgeContext, TM1629_PLATFORM_WRAP_SIGNAL_DIO_DIR, Dir);
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.DirDIO(Wrap->Inner.Context, Dir);
+}
+
+static int8_t
+TM1629_PlatformWrap_DelayUs(void *Context, uint8_t Delay)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  Wrap->TimeNs += (uint64_t)Delay * 1000;
+  if (TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.DelayUs)
+    return TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.DelayUs(Wrap->Inner.Context, Delay);
+
+  // DelayNs takes at most 65535 ns, longer delays are split
+  for (; Delay > PLATFORM_WRAP_MAX_DELAY_NS_US; Delay -= PLATFORM_WRAP_MAX_DELAY_NS_US)
+  {
+    if (TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.DelayNs(Wrap->Inner.Context,
+                                                       PLATFORM_WRAP_MAX_DELAY_NS_US * 1000) < 0)
+      return -1;
+  }
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.DelayNs(Wrap->Inner.Context,
+                                                        (uint16_t)(Delay * 1000));
+}
+
+static int8_t
+TM1629_PlatformWrap_DelayNs(void *Context, uint16_t Delay)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  Wrap->TimeNs += Delay;
+  if (TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.DelayNs)
+    return TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.DelayNs(Wrap->Inner.Context, Delay);
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->GPIO.DelayUs(Wrap->Inner.Context, (Delay + 999) / 1000);
+}
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+static uint32_t
+TM1629_PlatformWrap_GetTimeUs(void *Context)
+{
+  TM1629_PlatformWrap_t *Wrap = TM1629_PLATFORM_WRAP(Context);
+
+  return TM1629_PLATFORM_WRAP_INNER(Wrap)->GetTimeUs(Wrap->Inner.Context);
+}
+#endif
+
+
+
+/**
+ ==================================================================================
+                            ##### Public Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Wrap the platform layer of handler
+ * @param  Wrap: Pointer to wrapper ('Edge' and 'EdgeContext' must be set)
+ * @param  Handler: Pointer to handler with its platform layer already linked.
+ *                  Call TM1629_Init after this function.
+ * @note   Buffer-level GPIO functions, MMIO registers and waveform playback are
+ *         not used while wrapped (pin functions must be linked), so every edge
+ *         goes through the wrapper. SPI communication is not wrapped.
+ * @retval None
+ */
+void
+TM1629_PlatformWrap_Attach(TM1629_PlatformWrap_t *Wrap, TM1629_Handler_t *Handler)
+{
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  TM1629_PlatformOps_t *Ops = &Wrap->Ops;
+#else
+  TM1629_Platform_t *Ops = &Handler->Platform;
+#endif
+
+  Wrap->Inner = Handler->Platform;
+
+  TM1629_PLATFORM_SET_CONTEXT(Handler, Wrap);
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  // Functions not set below are not used while wrapped
+  memset(Ops, 0, sizeof(TM1629_PlatformOps_t));
+  TM1629_PLATFORM_LINK_OPS(Handler, Ops);
+#endif
+  Ops->Init = TM1629_PlatformWrap_Init;
+  Ops->DeInit = TM1629_PlatformWrap_DeInit;
+  Ops->WriteSTB = TM1629_PlatformWrap_WriteSTB;
+
+#if (TM1629_CONFIG_ENABLE_STATS)
+  if (TM1629_PLATFORM_WRAP_INNER(Wrap)->GetTimeUs)
+    Ops->GetTimeUs = TM1629_PlatformWrap_GetTimeUs;
+#endif
+
+  Ops->GPIO.DirDIO = TM1629_PlatformWrap_DirDIO;
+  Ops->GPIO.WriteDIO = TM1629_PlatformWrap_WriteDIO;
+  Ops->GPIO.ReadDIO = TM1629_PlatformWrap_ReadDIO;
+  Ops->GPIO.WriteCLK = TM1629_PlatformWrap_WriteCLK;
+  Ops->GPIO.DelayUs = TM1629_PlatformWrap_DelayUs;
+  Ops->GPIO.DelayNs = TM1629_PlatformWrap_DelayNs;
+  Ops->GPIO.WriteBuffer = NULL;
+  Ops->GPIO.ReadBuffer = NULL;
+#if (TM1629_CONFIG_SUPPORT_MMIO)
+  TM1629_PLATFORM_SET_MMIO_REGS(Handler, NULL, NULL, NULL);
+#endif
+#if (TM1629_CONFIG_SUPPORT_WAVEFORM)
+  Ops->GPIO.Waveform.Play = NULL;
+#endif
+}
+
+/**
+ * @brief  Restore the platform layer of handler
+ * @param  Wrap: Pointer to wrapper
+ * @param  Handler: Pointer to handler
+ * @retval None
+ */
+void
+TM1629_PlatformWrap_Detach(TM1629_PlatformWrap_t *Wrap, TM1629_Handler_t *Handler)
+{
+  Handler->Platform = Wrap->Inner;
+}
@@ -0,0 +1,146 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_platform_wrap.h
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Platform layer wrapper reporting pin changes of a handler (host side)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Define to prevent recursive inclusion ----------------------------------------*/
+#ifndef _TM1629_PLATFORM_WRAP_H_
+#define _TM1629_PLATFORM_WRAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629.h"
+#include <stdint.h>
+
+
+#if (TM1629_CONFIG_SUPPORT_GPIO == 0)
+  #error "TM1629: Platform wrapper needs GPIO support!"
+#endif
+
+#if (TM1629_CONFIG_STATIC_PLATFORM)
+  #error "TM1629: Platform wrapper wraps linked platform functions, disable static platform!"
+#endif
+
+
+
+/* Exported Data Types ----------------------------------------------------------*/
+/**
+ * @brief  Pin changes reported by the wrapper
+ */
+typedef enum TM1629_PlatformWrap_Signal_e
+{
+  TM1629_PLATFORM_WRAP_SIGNAL_STB = 0,
+  TM1629_PLATFORM_WRAP_SIGNAL_CLK,
+  // DIO written by the driver
+  TM1629_PLATFORM_WRAP_SIGNAL_DIO,
+  // Direction of DIO on the driver side (0: Input, 1: Output)
+  TM1629_PLATFORM_WRAP_SIGNAL_DIO_DIR,
+  // DIO read by the driver (driven by the chip)
+  TM1629_PLATFORM_WRAP_SIGNAL_DIO_READ,
+} TM1629_PlatformWrap_Signal_t;
+
+
+/**
+ * @brief  Function type for reporting a pin change
+ * @param  Context: 'Wrap.EdgeContext'
+ * @param  Signal: Changed signal
+ * @param  Level: Level written or read
+ * @note   It is called before the wrapped function for writes and after it
+ *         for reads.
+ * @retval None
+ */
+typedef void (*TM1629_PlatformWrap_Edge_t)(void *Context,
+                                           TM1629_PlatformWrap_Signal_t Signal,
+                                           uint8_t Level);
+
+
+/**
+ * @brief  Platform layer wrapper
+ * @note   The wrapper takes the place of the platform layer of a handler,
+ *         reports every pin change through 'Edge' and forwards every call to
+ *         the wrapped platform layer ('Inner').
+ */
+typedef struct TM1629_PlatformWrap_s
+{
+  // Wrapped platform layer
+  TM1629_Platform_t Inner;
+#if (TM1629_CONFIG_SHARED_PLATFORM_OPS)
+  // Wrapper functions linked to the handler
+  TM1629_PlatformOps_t Ops;
+#endif
+
+  // Pin change report
+  TM1629_PlatformWrap_Edge_t Edge;
+  void *EdgeContext;
+
+  // Virtual time: sum of delays requested by the driver (ns)
+  uint64_t TimeNs;
+} TM1629_PlatformWrap_t;
+
+
+
+/**
+ ==================================================================================
+                               ##### Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Wrap the platform layer of handler
+ * @param  Wrap: Pointer to wrapper ('Edge' and 'EdgeContext' must be set)
+ * @param  Handler: Pointer to handler with its platform layer already linked.
+ *                  Call TM1629_Init after this function.
+ * @note   Buffer-level GPIO functions, MMIO registers and waveform playback are
+ *         not used while wrapped (pin functions must be linked), so every edge
+ *         goes through the wrapper. SPI communication is not wrapped.
+ * @retval None
+ */
+void
+TM1629_PlatformWrap_Attach(TM1629_PlatformWrap_t *Wrap, TM1629_Handler_t *Handler);
+
+
+/**
+ * @brief  Restore the platform layer of handler
+ * @param  Wrap: Pointer to wrapper
+ * @param  Handler: Pointer to handler
+ * @retval None
+ */
+void
+TM1629_PlatformWrap_Detach(TM1629_PlatformWrap_t *Wrap, TM1629_Handler_t *Handler);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //! _TM1629_PLATFORM_WRAP_H_
@@ -0,0 +1,448 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_timing_check.c
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Protocol timing checker of TM1629 bus (host side)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629_timing_check.h"
+
+
+/* Private Constants ------------------------------------------------------------*/
+/**
+ * @brief  Data setting command with key read mode
+ */
+#define TIMING_COMMAND_MASK     0xC0
+#define TIMING_DATA_COMMAND     0x40
+#define TIMING_DATA_READ_KEYS   0x02
+
+/**
+ * @brief  Unknown level of a signal
+ */
+#define TIMING_UNKNOWN          0xFF
+
+/**
+ * @brief  Flags of 'Known' (timestamps which hold a valid edge)
+ */
+#define TIMING_KNOWN_STB_RISE   0x01
+#define TIMING_KNOWN_CLK_RISE   0x02
+#define TIMING_KNOWN_CLK_FALL   0x04
+#define TIMING_KNOWN_DIO        0x08
+#define TIMING_KNOWN_COMMAND    0x10
+
+
+/* Private Macros ---------------------------------------------------------------*/
+#define TM1629_TIMING_CHECK(CONTEXT)  ((TM1629_TimingCheck_t *)(CONTEXT))
+
+
+
+/**
+ ==================================================================================
+                           ##### Private Functions #####
+ ==================================================================================
+ */
+
+static void
+TM1629_TimingCheck_Measure(TM1629_TimingCheck_t *Check, TM1629_TimingRule_t Rule,
+                           uint64_t StartNs, uint64_t TimeNs)
+{
+  uint64_t Measured = TimeNs - StartNs;
+  int64_t Margin = 0;
+
+  if (Measured > INT32_MAX)
+    Measured = INT32_MAX;
+
+  Margin = (int64_t)Measured - (int64_t)Check->LimitNs[Rule];
+  if (Margin < Check->MarginNs[Rule])
+    Check->MarginNs[Rule] = (int32_t)Margin;
+  Check->Checks[Rule]++;
+
+  if (Margin >= 0)
+    return;
+
+  Check->Violations[Rule]++;
+  if (Check->Report)
+    Check->Report(Check->ReportContext, Rule, TimeNs,
+                  (uint32_t)Measured, Check->LimitNs[Rule]);
+}
+
+
+static void
+TM1629_TimingCheck_EdgeSTB(TM1629_TimingCheck_t *Check, uint8_t Level,
+                           uint64_t TimeNs)
+{
+  if (Level)
+  {
+    // End of transaction
+    if (Check->NumOfBits || Check->NumOfBytes)
+    {
+      if (Check->Known & TIMING_KNOWN_CLK_RISE)
+        TM1629_TimingCheck_Measure(Check, TM1629_TIMING_RULE_CLK_STB,
+                                   Check->CLKRiseNs, TimeNs);
+    }
+
+    Check->STBRiseNs = TimeNs;
+    Check->Known |= TIMING_KNOWN_STB_RISE;
+    return;
+  }
+
+  // Start of transaction
+  if (Check->Known & TIMING_KNOWN_STB_RISE)
+    TM1629_TimingCheck_Measure(Check, TM1629_TIMING_RULE_PW_STB,
+                               Check->STBRiseNs, TimeNs);
+
+  Check->Shift = 0;
+  Check->NumOfBits = 0;
+  Check->NumOfBytes = 0;
+  Check->Reading = 0;
+  Check->HoldPending = 0;
+  Check->Known &= (uint8_t)~(TIMING_KNOWN_CLK_RISE | TIMING_KNOWN_CLK_FALL |
+                             TIMING_KNOWN_COMMAND);
+}
+
+
+static void
+TM1629_TimingCheck_EdgeCLK(TM1629_TimingCheck_t *Check, uint8_t Level,
+                           uint64_t TimeNs)
+{
+  if (Check->STB != 0)
+    return;
+
+  if (!Level)
+  {
+    if (Check->Known & TIMING_KNOWN_CLK_RISE)
+      TM1629_TimingCheck_Measure(Check, TM1629_TIMING_RULE_PW_CLK_HIGH,
+                                 Check->CLKRiseNs, TimeNs);
+
+    // First clock of the key data
+    if (Check->Known & TIMING_KNOWN_COMMAND)
+    {
+      TM1629_TimingCheck_Measure(Check, TM1629_TIMING_RULE_WAIT,
+                                 Check->CommandEndNs, TimeNs);
+      Check->Known &= (uint8_t)~TIMING_KNOWN_COMMAND;
+    }
+
+    Check->CLKFallNs = TimeNs;
+    Check->Known |= TIMING_KNOWN_CLK_FALL;
+    return;
+  }
+
+  if (Check->Known & TIMING_KNOWN_CLK_FALL)
+    TM1629_TimingCheck_Measure(Check, TM1629_TIMING_RULE_PW_CLK_LOW,
+                               Check->CLKFallNs, TimeNs);
+
+  Check->CLKRiseNs = TimeNs;
+  Check->Known |= TIMING_KNOWN_CLK_RISE;
+
+  // Bits driven by the chip are not checked
+  if (Check->Reading || Check->DirDIO == 0)
+    return;
+
+  if (Check->Known & TIMING_KNOWN_DIO)
+    TM1629_TimingCheck_Measure(Check, TM1629_TIMING_RULE_SETUP,
+                               Check->DIOChangeNs, TimeNs);
+  Check->HoldPending = 1;
+
+  Check->Shift >>= 1;
+  if (Check->DIO)
+    Check->Shift |= 0x80;
+  if (++Check->NumOfBits < 8)
+    return;
+
+  // The first byte of a read command is followed by key data
+  if (Check->NumOfBytes == 0 &&
+      (Check->Shift & TIMING_COMMAND_MASK) == TIMING_DATA_COMMAND &&
+      (Check->Shift & TIMING_DATA_READ_KEYS))
+  {
+    Check->Reading = 1;
+    Check->CommandEndNs = TimeNs;
+    Check->Known |= TIMING_KNOWN_COMMAND;
+  }
+  Check->NumOfBits = 0;
+  Check->NumOfBytes++;
+}
+
+
+static void
+TM1629_TimingCheck_EdgeDIO(TM1629_TimingCheck_t *Check, uint64_t TimeNs)
+{
+  if (Check->HoldPending)
+  {
+    TM1629_TimingCheck_Measure(Check, TM1629_TIMING_RULE_HOLD,
+                               Check->CLKRiseNs, TimeNs);
+    Check->HoldPending = 0;
+  }
+
+  Check->DIOChangeNs = TimeNs;
+  Check->Known |= TIMING_KNOWN_DIO;
+}
+
+
+static uint64_t
+TM1629_TimingCheck_Now(TM1629_TimingCheck_t *Check)
+{
+  if (Check->Clock)
+    return Check->Clock(Check->ClockContext);
+
+  return Check->Wrap.TimeNs;
+}
+
+
+static void
+TM1629_TimingCheck_WrapEdge(void *Context, TM1629_PlatformWrap_Signal_t Signal,
+                            uint8_t Level)
+{
+  TM1629_TimingCheck_t *Check = TM1629_TIMING_CHECK(Context);
+
+  switch (Signal)
+  {
+  case TM1629_PLATFORM_WRAP_SIGNAL_STB:
+    TM1629_TimingCheck_Edge(Check, TM1629_TIMING_SIGNAL_STB, Level,
+                            TM1629_TimingCheck_Now(Check));
+    break;
+
+  case TM1629_PLATFORM_WRAP_SIGNAL_CLK:
+    TM1629_TimingCheck_Edge(Check, TM1629_TIMING_SIGNAL_CLK, Level,
+                            TM1629_TimingCheck_Now(Check));
+    break;
+
+  case TM1629_PLATFORM_WRAP_SIGNAL_DIO:
+    TM1629_TimingCheck_Edge(Check, TM1629_TIMING_SIGNAL_DIO, Level,
+                            TM1629_TimingCheck_Now(Check));
+    break;
+
+  case TM1629_PLATFORM_WRAP_SIGNAL_DIO_DIR:
+    TM1629_TimingCheck_Edge(Check, TM1629_TIMING_SIGNAL_DIO_DIR, Level,
+                            TM1629_TimingCheck_Now(Check));
+    break;
+
+  // Bits driven by the chip are not checked
+  default:
+    break;
+  }
+}
+
+
+
+/**
+ ==================================================================================
+                            ##### Public Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Load datasheet limits and reset results
+ * @param  Check: Pointer to checker
+ * @note   Report, Clock and their contexts are not touched. Limits can be
+ *         changed afterwards.
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Init(TM1629_TimingCheck_t *Check)
+{
+  Check->LimitNs[TM1629_TIMING_RULE_PW_CLK_HIGH] = TM1629_TIMING_CHECK_DEFAULT_PW_CLK_NS;
+  Check->LimitNs[TM1629_TIMING_RULE_PW_CLK_LOW] = TM1629_TIMING_CHECK_DEFAULT_PW_CLK_NS;
+  Check->LimitNs[TM1629_TIMING_RULE_PW_STB] = TM1629_TIMING_CHECK_DEFAULT_PW_STB_NS;
+  Check->LimitNs[TM1629_TIMING_RULE_SETUP] = TM1629_TIMING_CHECK_DEFAULT_SETUP_NS;
+  Check->LimitNs[TM1629_TIMING_RULE_HOLD] = TM1629_TIMING_CHECK_DEFAULT_HOLD_NS;
+  Check->LimitNs[TM1629_TIMING_RULE_CLK_STB] = TM1629_TIMING_CHECK_DEFAULT_CLK_STB_NS;
+  Check->LimitNs[TM1629_TIMING_RULE_WAIT] = TM1629_TIMING_CHECK_DEFAULT_WAIT_NS;
+
+  TM1629_TimingCheck_Reset(Check);
+}
+
+/**
+ * @brief  Reset results and edge stream state (limits are kept)
+ * @param  Check: Pointer to checker
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Reset(TM1629_TimingCheck_t *Check)
+{
+  uint8_t i = 0;
+
+  for (i = 0; i < TM1629_TIMING_RULE_COUNT; i++)
+  {
+    Check->MarginNs[i] = INT32_MAX;
+    Check->Checks[i] = 0;
+    Check->Violations[i] = 0;
+  }
+
+  Check->Wrap.TimeNs = 0;
+  Check->STB = TIMING_UNKNOWN;
+  Check->CLK = TIMING_UNKNOWN;
+  Check->DIO = TIMING_UNKNOWN;
+  Check->DirDIO = 1;
+  Check->Shift = 0;
+  Check->NumOfBits = 0;
+  Check->NumOfBytes = 0;
+  Check->Reading = 0;
+  Check->HoldPending = 0;
+  Check->Known = 0;
+}
+
+/**
+ * @brief  Feed one edge to the checker
+ * @param  Check: Pointer to checker
+ * @param  Signal: Signal of the edge
+ * @param  Level: New level of the signal
+ * @param  TimeNs: Time of the edge. It must not decrease.
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Edge(TM1629_TimingCheck_t *Check,
+                        TM1629_TimingSignal_t Signal,
+                        uint8_t Level, uint64_t TimeNs)
+{
+  uint8_t Last = 0;
+
+  Level = Level ? 1 : 0;
+
+  switch (Signal)
+  {
+  case TM1629_TIMING_SIGNAL_STB:
+    Last = Check->STB;
+    Check->STB = Level;
+    if (Last != TIMING_UNKNOWN && Last != Level)
+      TM1629_TimingCheck_EdgeSTB(Check, Level, TimeNs);
+    break;
+
+  case TM1629_TIMING_SIGNAL_CLK:
+    Last = Check->CLK;
+    Check->CLK = Level;
+    if (Last != TIMING_UNKNOWN && Last != Level)
+      TM1629_TimingCheck_EdgeCLK(Check, Level, TimeNs);
+    break;
+
+  case TM1629_TIMING_SIGNAL_DIO:
+    Last = Check->DIO;
+    Check->DIO = Level;
+    if (Last != Level && Check->DirDIO)
+      TM1629_TimingCheck_EdgeDIO(Check, TimeNs);
+    break;
+
+  case TM1629_TIMING_SIGNAL_DIO_DIR:
+    Check->DirDIO = Level;
+    // The level driven after turnaround is a new data change
+    if (Level)
+      Check->DIO = TIMING_UNKNOWN;
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief  Wrap the platform layer of handler with the checker
+ * @param  Check: Pointer to checker
+ * @param  Handler: Pointer to handler with its platform layer already linked.
+ *                  Call TM1629_Init after this function.
+ * @note   Buffer-level GPIO functions, MMIO registers and waveform playback are
+ *         not used while checking (pin functions must be linked).
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Attach(TM1629_TimingCheck_t *Check, TM1629_Handler_t *Handler)
+{
+  Check->Wrap.Edge = TM1629_TimingCheck_WrapEdge;
+  Check->Wrap.EdgeContext = Check;
+  TM1629_PlatformWrap_Attach(&Check->Wrap, Handler);
+}
+
+/**
+ * @brief  Restore the platform layer of handler
+ * @param  Check: Pointer to checker
+ * @param  Handler: Pointer to handler
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Detach(TM1629_TimingCheck_t *Check, TM1629_Handler_t *Handler)
+{
+  TM1629_PlatformWrap_Detach(&Check->Wrap, Handler);
+}
+
+/**
+ * @brief  Get total number of violations
+ * @param  Check: Pointer to checker
+ * @retval Number of violations of all constraints
+ */
+uint32_t
+TM1629_TimingCheck_GetViolations(const TM1629_TimingCheck_t *Check)
+{
+  uint32_t Sum = 0;
+  uint8_t i = 0;
+
+  for (i = 0; i < TM1629_TIMING_RULE_COUNT; i++)
+    Sum += Check->Violations[i];
+
+  return Sum;
+}
+
+/**
+ * @brief  Get name of a constraint
+ * @param  Rule: Constraint
+ * @retval Name of the constraint
+ */
+const char *
+TM1629_TimingCheck_RuleName(TM1629_TimingRule_t Rule)
+{
+  static const char *const Names[TM1629_TIMING_RULE_COUNT] =
+  {
+    "PW_CLK_HIGH", "PW_CLK_LOW", "PW_STB", "SETUP", "HOLD", "CLK_STB", "WAIT"
+  };
+
+  if (Rule >= TM1629_TIMING_RULE_COUNT)
+    return "?";
+  return Names[Rule];
+}
+
+/**
+ * @brief  Print tightest margin and violations of each constraint
+ * @param  Check: Pointer to checker
+ * @param  File: Output file
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Print(const TM1629_TimingCheck_t *Check, FILE *File)
+{
+  uint8_t i = 0;
+
+  fprintf(File, "%-12s %8s %8s %12s %10s\n",
+          "rule", "limit", "checks", "margin", "violations");
+  for (i = 0; i < TM1629_TIMING_RULE_COUNT; i++)
+  {
+    fprintf(File, "%-12s %8lu %8lu ",
+            TM1629_TimingCheck_RuleName((TM1629_TimingRule_t)i),
+            (unsigned long)Check->LimitNs[i], (unsigned long)Check->Checks[i]);
+    if (Check->Checks[i])
+      fprintf(File, "%12ld", (long)Check->MarginNs[i]);
+    else
+      fprintf(File, "%12s", "-");
+    fprintf(File, " %10lu\n", (unsigned long)Check->Violations[i]);
+  }
+}
@@ -0,0 +1,259 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_timing_check.h
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Protocol timing checker of TM1629 bus (host side)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Define to prevent recursive inclusion ----------------------------------------*/
+#ifndef _TM1629_TIMING_CHECK_H_
+#define _TM1629_TIMING_CHECK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629.h"
+#include "TM1629_platform_wrap.h"
+#include <stdint.h>
+#include <stdio.h>
+
+
+
+/* Exported Constants -----------------------------------------------------------*/
+/**
+ * @brief  Timing limits of TM1629 datasheet in nanoseconds
+ */
+#define TM1629_TIMING_CHECK_DEFAULT_PW_CLK_NS   400   // CLK pulse width
+#define TM1629_TIMING_CHECK_DEFAULT_PW_STB_NS   1000  // STB pulse width
+#define TM1629_TIMING_CHECK_DEFAULT_SETUP_NS    100   // Data setup time
+#define TM1629_TIMING_CHECK_DEFAULT_HOLD_NS     100   // Data hold time
+#define TM1629_TIMING_CHECK_DEFAULT_CLK_STB_NS  1000  // CLK rising to STB rising
+#define TM1629_TIMING_CHECK_DEFAULT_WAIT_NS     1000  // Read command to first read CLK
+
+
+
+/* Exported Data Types ----------------------------------------------------------*/
+/**
+ * @brief  Checked timing constraints
+ */
+typedef enum TM1629_TimingRule_e
+{
+  TM1629_TIMING_RULE_PW_CLK_HIGH = 0,
+  TM1629_TIMING_RULE_PW_CLK_LOW,
+  TM1629_TIMING_RULE_PW_STB,
+  TM1629_TIMING_RULE_SETUP,
+  TM1629_TIMING_RULE_HOLD,
+  TM1629_TIMING_RULE_CLK_STB,
+  TM1629_TIMING_RULE_WAIT,
+  TM1629_TIMING_RULE_COUNT
+} TM1629_TimingRule_t;
+
+
+/**
+ * @brief  Signals of the edge stream
+ */
+typedef enum TM1629_TimingSignal_e
+{
+  TM1629_TIMING_SIGNAL_STB = 0,
+  TM1629_TIMING_SIGNAL_CLK,
+  TM1629_TIMING_SIGNAL_DIO,
+  // Direction of DIO on the driver side (0: Input, 1: Output)
+  TM1629_TIMING_SIGNAL_DIO_DIR,
+} TM1629_TimingSignal_t;
+
+
+/**
+ * @brief  Function type for reporting a violation
+ * @param  Context: 'Check.ReportContext'
+ * @param  Rule: Violated constraint
+ * @param  TimeNs: Time of the edge which completed the measurement
+ * @param  MeasuredNs: Measured time
+ * @param  LimitNs: Minimum time of the constraint
+ * @retval None
+ */
+typedef void (*TM1629_TimingCheck_Report_t)(void *Context,
+                                            TM1629_TimingRule_t Rule,
+                                            uint64_t TimeNs,
+                                            uint32_t MeasuredNs,
+                                            uint32_t LimitNs);
+
+
+/**
+ * @brief  Function type for reading the clock used as timestamps
+ * @param  Context: 'Check.ClockContext'
+ * @retval Time in nanoseconds
+ */
+typedef uint64_t (*TM1629_TimingCheck_Clock_t)(void *Context);
+
+
+/**
+ * @brief  Timing checker
+ * @note   Edges are fed by TM1629_TimingCheck_Edge, or by the checker itself
+ *         when it wraps the platform layer of a handler
+ *         (TM1629_TimingCheck_Attach). Without 'Clock', the wrapper uses the
+ *         sum of delays requested by the driver as time.
+ */
+typedef struct TM1629_TimingCheck_s
+{
+  // Minimum time of each constraint (ns), loaded by TM1629_TimingCheck_Init
+  uint32_t LimitNs[TM1629_TIMING_RULE_COUNT];
+
+  // Tightest margin seen (measured - limit), INT32_MAX if never measured
+  int32_t MarginNs[TM1629_TIMING_RULE_COUNT];
+  // Number of measurements and violations
+  uint32_t Checks[TM1629_TIMING_RULE_COUNT];
+  uint32_t Violations[TM1629_TIMING_RULE_COUNT];
+
+  // Violation report (optional)
+  TM1629_TimingCheck_Report_t Report;
+  void *ReportContext;
+
+  // Timestamp source of the wrapper (optional)
+  TM1629_TimingCheck_Clock_t Clock;
+  void *ClockContext;
+  // Platform layer wrapper (its virtual time is used without 'Clock')
+  TM1629_PlatformWrap_t Wrap;
+
+  // Edge stream state
+  uint8_t STB;
+  uint8_t CLK;
+  uint8_t DIO;
+  uint8_t DirDIO;
+  uint8_t Shift;
+  uint8_t NumOfBits;
+  uint8_t NumOfBytes;
+  uint8_t Reading;
+  uint8_t HoldPending;
+  uint8_t Known;
+  uint64_t STBRiseNs;
+  uint64_t CLKRiseNs;
+  uint64_t CLKFallNs;
+  uint64_t DIOChangeNs;
+  uint64_t CommandEndNs;
+} TM1629_TimingCheck_t;
+
+
+
+/**
+ ==================================================================================
+                               ##### Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Load datasheet limits and reset results
+ * @param  Check: Pointer to checker
+ * @note   Report, Clock and their contexts are not touched. Limits can be
+ *         changed afterwards.
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Init(TM1629_TimingCheck_t *Check);
+
+
+/**
+ * @brief  Reset results and edge stream state (limits are kept)
+ * @param  Check: Pointer to checker
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Reset(TM1629_TimingCheck_t *Check);
+
+
+/**
+ * @brief  Feed one edge to the checker
+ * @param  Check: Pointer to checker
+ * @param  Signal: Signal of the edge
+ * @param  Level: New level of the signal
+ * @param  TimeNs: Time of the edge. It must not decrease.
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Edge(TM1629_TimingCheck_t *Check,
+                        TM1629_TimingSignal_t Signal,
+                        uint8_t Level, uint64_t TimeNs);
+
+
+/**
+ * @brief  Wrap the platform layer of handler with the checker
+ * @param  Check: Pointer to checker
+ * @param  Handler: Pointer to handler with its platform layer already linked.
+ *                  Call TM1629_Init after this function.
+ * @note   Buffer-level GPIO functions, MMIO registers and waveform playback are
+ *         not used while checking (pin functions must be linked).
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Attach(TM1629_TimingCheck_t *Check, TM1629_Handler_t *Handler);
+
+
+/**
+ * @brief  Restore the platform layer of handler
+ * @param  Check: Pointer to checker
+ * @param  Handler: Pointer to handler
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Detach(TM1629_TimingCheck_t *Check, TM1629_Handler_t *Handler);
+
+
+/**
+ * @brief  Get total number of violations
+ * @param  Check: Pointer to checker
+ * @retval Number of violations of all constraints
+ */
+uint32_t
+TM1629_TimingCheck_GetViolations(const TM1629_TimingCheck_t *Check);
+
+
+/**
+ * @brief  Get name of a constraint
+ * @param  Rule: Constraint
+ * @retval Name of the constraint
+ */
+const char *
+TM1629_TimingCheck_RuleName(TM1629_TimingRule_t Rule);
+
+
+/**
+ * @brief  Print tightest margin and violations of each constraint
+ * @param  Check: Pointer to checker
+ * @param  File: Output file
+ * @retval None
+ */
+void
+TM1629_TimingCheck_Print(const TM1629_TimingCheck_t *Check, FILE *File);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //! _TM1629_TIMING_CHECK_H_
@@ -0,0 +1,247 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_vcd.c
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Platform layer wrapper recording TM1629 bus activity as a VCD file
+ *         (host side)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Includes ---------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 199309L
+#include "TM1629_vcd.h"
+#include <time.h>
+
+
+/* Private Constants ------------------------------------------------------------*/
+/**
+ * @brief  VCD identifiers of the signals
+ */
+#define VCD_ID_STB      '!'
+#define VCD_ID_CLK      '"'
+#define VCD_ID_DIO      '#'
+#define VCD_ID_DIR_DIO  '$'
+
+#define VCD_UNKNOWN     0xFF
+
+
+/* Private Macros ---------------------------------------------------------------*/
+#define TM1629_VCD(CONTEXT)  ((TM1629_VCD_t *)(CONTEXT))
+
+
+
+/**
+ ==================================================================================
+                           ##### Private Functions #####
+ ==================================================================================
+ */
+
+static uint64_t
+TM1629_VCD_Now(TM1629_VCD_t *VCD)
+{
+  if (VCD->Clock)
+    return VCD->Clock(VCD->ClockContext);
+
+  return VCD->Wrap.TimeNs;
+}
+
+static void
+TM1629_VCD_Dump(TM1629_VCD_t *VCD, uint8_t *Last, char Id, uint8_t Value)
+{
+  uint64_t Now = 0;
+
+  Value = Value ? 1 : 0;
+  if (!VCD->File || *Last == Value)
+    return;
+
+  Now = TM1629_VCD_Now(VCD);
+  if (Now != VCD->LastTimeNs)
+  {
+    fprintf(VCD->File, "#%llu\n", (unsigned long long)Now);
+    VCD->LastTimeNs = Now;
+  }
+
+  fprintf(VCD->File, "%u%c\n", Value, Id);
+  *Last = Value;
+}
+
+
+static void
+TM1629_VCD_Edge(void *Context, TM1629_PlatformWrap_Signal_t Signal, uint8_t Level)
+{
+  TM1629_VCD_t *VCD = TM1629_VCD(Context);
+
+  switch (Signal)
+  {
+  case TM1629_PLATFORM_WRAP_SIGNAL_STB:
+    TM1629_VCD_Dump(VCD, &VCD->STB, VCD_ID_STB, Level);
+    break;
+
+  case TM1629_PLATFORM_WRAP_SIGNAL_CLK:
+    TM1629_VCD_Dump(VCD, &VCD->CLK, VCD_ID_CLK, Level);
+    break;
+
+  // DIO is driven by the chip while reading keys
+  case TM1629_PLATFORM_WRAP_SIGNAL_DIO:
+  case TM1629_PLATFORM_WRAP_SIGNAL_DIO_READ:
+    TM1629_VCD_Dump(VCD, &VCD->DIO, VCD_ID_DIO, Level);
+    break;
+
+  case TM1629_PLATFORM_WRAP_SIGNAL_DIO_DIR:
+    TM1629_VCD_Dump(VCD, &VCD->DirDIO, VCD_ID_DIR_DIO, Level);
+    break;
+
+  default:
+    break;
+  }
+}
+
+
+
+/**
+ ==================================================================================
+                            ##### Public Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Open VCD file and write its header
+ * @param  VCD: Pointer to recorder
+ * @param  Path: Path of the VCD file
+ * @note   'Clock' and 'ClockContext' are not touched.
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+int8_t
+TM1629_VCD_Open(TM1629_VCD_t *VCD, const char *Path)
+{
+  VCD->File = fopen(Path, "w");
+  if (!VCD->File)
+    return -1;
+
+  VCD->Wrap.TimeNs = 0;
+  VCD->LastTimeNs = TM1629_VCD_Now(VCD);
+  VCD->STB = VCD_UNKNOWN;
+  VCD->CLK = VCD_UNKNOWN;
+  VCD->DIO = VCD_UNKNOWN;
+  VCD->DirDIO = VCD_UNKNOWN;
+
+  fprintf(VCD->File,
+          "$version TM1629 bus recorder $end\n"
+          "$timescale 1ns $end\n"
+          "$scope module TM1629 $end\n"
+          "$var wire 1 %c STB $end\n"
+          "$var wire 1 %c CLK $end\n"
+          "$var wire 1 %c DIO $end\n"
+          "$var wire 1 %c DIO_OUT $end\n"
+          "$upscope $end\n"
+          "$enddefinitions $end\n"
+          "#%llu\n"
+          "$dumpvars\nx%c\nx%c\nx%c\nx%c\n$end\n",
+          VCD_ID_STB, VCD_ID_CLK, VCD_ID_DIO, VCD_ID_DIR_DIO,
+          (unsigned long long)VCD->LastTimeNs,
+          VCD_ID_STB, VCD_ID_CLK, VCD_ID_DIO, VCD_ID_DIR_DIO);
+
+  return 0;
+}
+
+/**
+ * @brief  Wrap the platform layer of handler with the recorder
+ * @param  VCD: Pointer to recorder
+ * @param  Handler: Pointer to handler with its platform layer already linked.
+ *                  Call TM1629_Init after this function.
+ * @note   Buffer-level GPIO functions, MMIO registers and waveform playback are
+ *         not used while recording (pin functions must be linked), so every
+ *         edge goes through the recorder. SPI communication is not recorded.
+ * @retval None
+ */
+void
+TM1629_VCD_Attach(TM1629_VCD_t *VCD, TM1629_Handler_t *Handler)
+{
+  VCD->Wrap.Edge = TM1629_VCD_Edge;
+  VCD->Wrap.EdgeContext = VCD;
+  TM1629_PlatformWrap_Attach(&VCD->Wrap, Handler);
+}
+
+/**
+ * @brief  Restore the platform layer of handler and close VCD file
+ * @param  VCD: Pointer to recorder
+ * @param  Handler: Pointer to handler
+ * @retval None
+ */
+void
+TM1629_VCD_Close(TM1629_VCD_t *VCD, TM1629_Handler_t *Handler)
+{
+  if (Handler)
+    TM1629_PlatformWrap_Detach(&VCD->Wrap, Handler);
+
+  if (VCD->File)
+  {
+    // End time makes the last levels visible in viewers
+    if (TM1629_VCD_Now(VCD) != VCD->LastTimeNs)
+      fprintf(VCD->File, "#%llu\n", (unsigned long long)TM1629_VCD_Now(VCD));
+    fclose(VCD->File);
+    VCD->File = NULL;
+  }
+}
+
+/**
+ * @brief  Write a comment at the current time (e.g. name of the next API call)
+ * @param  VCD: Pointer to recorder
+ * @param  Text: Comment text
+ * @retval None
+ */
+void
+TM1629_VCD_Mark(TM1629_VCD_t *VCD, const char *Text)
+{
+  uint64_t Now = TM1629_VCD_Now(VCD);
+
+  if (!VCD->File)
+    return;
+
+  if (Now != VCD->LastTimeNs)
+  {
+    fprintf(VCD->File, "#%llu\n", (unsigned long long)Now);
+    VCD->LastTimeNs = Now;
+  }
+
+  fprintf(VCD->File, "$comment %s $end\n", Text);
+}
+
+/**
+ * @brief  Read the monotonic clock of the host
+ * @param  Context: Not used
+ * @retval Time in nanoseconds
+ */
+uint64_t
+TM1629_VCD_HostClockNs(void *Context)
+{
+  struct timespec Now;
+
+  (void)Context;
+  clock_gettime(CLOCK_MONOTONIC, &Now);
+  return (uint64_t)Now.tv_sec * 1000000000u + (uint64_t)Now.tv_nsec;
+}
@@ -0,0 +1,157 @@
+/**
+ **********************************************************************************
+ * @file   TM1629_vcd.h
+ * @author Hossein.M (https://github.com/Hossein-M98)
+ * @brief  Platform layer wrapper recording TM1629 bus activity as a VCD file
+ *         (host side)
+ **********************************************************************************
+ *
+ * Copyright (c) 2024 Mahda Embedded System (MIT License)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ **********************************************************************************
+ */
+
+/* Define to prevent recursive inclusion ----------------------------------------*/
+#ifndef _TM1629_VCD_H_
+#define _TM1629_VCD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* Includes ---------------------------------------------------------------------*/
+#include "TM1629.h"
+#include "TM1629_platform_wrap.h"
+#include <stdint.h>
+#include <stdio.h>
+
+
+
+/* Exported Data Types ----------------------------------------------------------*/
+/**
+ * @brief  Function type for reading the clock used as VCD timestamps
+ * @param  Context: 'VCD.ClockContext'
+ * @retval Time in nanoseconds
+ */
+typedef uint64_t (*TM1629_VCD_Clock_t)(void *Context);
+
+
+/**
+ * @brief  VCD recorder
+ * @note   The recorder takes the place of the platform layer of a handler
+ *         through 'Wrap', which forwards every call to the wrapped platform
+ *         layer.
+ * @note   Without 'Clock', timestamps are the sum of delays requested by the
+ *         driver (the same virtual time as the simulated TM1629).
+ */
+typedef struct TM1629_VCD_s
+{
+  // Output file
+  FILE *File;
+
+  // Platform layer wrapper (its virtual time is used without 'Clock')
+  TM1629_PlatformWrap_t Wrap;
+
+  // Timestamp source (optional, e.g. TM1629_VCD_HostClockNs)
+  TM1629_VCD_Clock_t Clock;
+  void *ClockContext;
+
+  // Time of the last dumped change
+  uint64_t LastTimeNs;
+
+  // Last dumped pin levels (0xFF: Unknown)
+  uint8_t STB;
+  uint8_t CLK;
+  uint8_t DIO;
+  uint8_t DirDIO;
+} TM1629_VCD_t;
+
+
+
+/**
+ ==================================================================================
+                               ##### Functions #####
+ ==================================================================================
+ */
+
+/**
+ * @brief  Open VCD file and write its header
+ * @param  VCD: Pointer to recorder
+ * @param  Path: Path of the VCD file
+ * @note   'Clock' and 'ClockContext' are not touched.
+ * @retval
+ *         -  0: The operation was successful.
+ *         - -1: The operation failed.
+ */
+int8_t
+TM1629_VCD_Open(TM1629_VCD_t *VCD, const char *Path);
+
+
+/**
+ * @brief  Wrap the platform layer of handler with the recorder
+ * @param  VCD: Pointer to recorder
+ * @param  Handler: Pointer to handler with its platform layer already linked.
+ *                  Call TM1629_Init after this function.
+ * @note   Buffer-level GPIO functions, MMIO registers and waveform playback are
+ *         not used while recording (pin functions must be linked), so every
+ *         edge goes through the recorder. SPI communication is not recorded.
+ * @retval None
+ */
+void
+TM1629_VCD_Attach(TM1629_VCD_t *VCD, TM1629_Handler_t *Handler);
+
+
+/**
+ * @brief  Restore the platform layer of handler and close VCD file
+ * @param  VCD: Pointer to recorder
+ * @param  Handler: Pointer to handler
+ * @retval None
+ */
+void
+TM1629_VCD_Close(TM1629_VCD_t *VCD, TM1629_Handler_t *Handler);
+
+
+/**
+ * @brief  Write a comment at the current time (e.g. name of the next API call)
+ * @param  VCD: Pointer to recorder
+ * @param  Text: Comment text
+ * @retval None
+ */
+void
+TM1629_VCD_Mark(TM1629_VCD_t *VCD, const char *Text);
+
+
+/**
+ * @brief  Read the monotonic clock of the host
+ * @param  Context: Not used
+ * @retval Time in nanoseconds
+ */
+uint64_t
+TM1629_VCD_HostClockNs(void *Context);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //! _TM1629_VCD_H_